@@ -15,9 +15,12 @@
 #include "Coroutines/Generator.hpp"
 #include "DesignPatterns/OutputIterator.hpp"
 #include "DesignPatterns/InputIterator.hpp"
+#include "Exceptions/IOException.hpp"
 
 #include <algorithm>
 #include <array>
+#include <bit>
+#include <charconv>
 #include <compare>
 #include <functional>
 #include <ranges>
@@ -33,8 +36,17 @@
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 #include <locale>
+#include <limits>
+#include <thread>
+#include <atomic>
+#include <optional>
+#include <exception>
+#include <memory>
+#include <system_error>
 
+#include <climits>
 #include <cstring>
 #include <cctype>
 #include <cuchar>
@@ -246,9 +258,534 @@ namespace Cxx
       /**
        * @brief The return value does not include array elements that contain an empty string.
        */
-      RemoveEmptyEntries = 0x1
+      RemoveEmptyEntries = 0x1,
+
+      /**
+       * @brief Trim white-space characters from each substring in the result.
+       *
+       *  If combined with RemoveEmptyEntries, substrings that consist only of white-space characters are also removed.
+       */
+      TrimEntries = 0x2
+    };
+
+    /**
+     * @brief Combina 2 opciones de StringSplitOptions, por ejemplo: Split<RemoveEmptyEntries | TrimEntries>(Text, ',').
+     */
+    [[nodiscard]] inline constexpr StringSplitOptions operator|(const StringSplitOptions left, const StringSplitOptions right) noexcept
+    {
+      return static_cast<StringSplitOptions>(std::to_underlying(left) | std::to_underlying(right));
+    }
+
+    [[nodiscard]] inline constexpr StringSplitOptions operator&(const StringSplitOptions left, const StringSplitOptions right) noexcept
+    {
+      return static_cast<StringSplitOptions>(std::to_underlying(left) & std::to_underlying(right));
+    }
+
+    /**
+     * @brief Indica si Options contiene la opción Option.
+     */
+    [[nodiscard]] inline constexpr bool HasOption(const StringSplitOptions Options, const StringSplitOptions Option) noexcept
+    {
+      return (Options & Option) == Option;
+    }
+
+    /**
+     * @brief Valor de MaxCount que indica que no hay límite en la cantidad de Tokens de Split.
+     */
+    inline constexpr size_t UnlimitedCount = std::numeric_limits<size_t>::max();
+
+    /**
+     * @brief Tamaño por defecto, en caracteres, del buffer que usa StreamSplit para leer los datos.
+     */
+    inline constexpr size_t DefaultStreamBufferSize = 64 * 1024;
+
+    /**
+     * @brief Cantidad de hilos que usan las sobrecargas concurrentes, por ejemplo: RangeCompare(ThreadCount{ 8 }, Left, Right) ó
+     *        ParallelSplit(Text, '\n', ThreadCount{ 8 }).
+     *
+     *  ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+     */
+    enum class ThreadCount : size_t
+    {
     };
 
+  } // namespace Algorithms
+
+  namespace Concepts
+  {
+    /**
+     * @brief Concepto que verifica que un tipo sea un Buscador con el protocolo de std::default_searcher sobre punteros a CharType.
+     *
+     *  searcher(first, last) debe regresar el par [inicio, fin) de la siguiente coincidencia, o [last, last) si no existe.
+     *
+     * @tparam Searcher Tipo del Buscador.
+     * @tparam CharType Tipo del caracter de la cadena donde se busca.
+     */
+    template <typename Searcher, typename CharType>
+    concept SearcherFor = // clang-format off
+      std::copy_constructible<Searcher> and requires(const Searcher& searcher, const CharType* pointer)
+      {
+        { searcher(pointer, pointer) } -> std::convertible_to<std::pair<const CharType*, const CharType*>>;
+      }; // clang-format on
+
+    /**
+     * @brief Concepto que verifica que un tipo sea un Lector secuencial de caracteres.
+     *
+     *  reader.Read(buffer, count) debe escribir como máximo count caracteres en buffer y regresar cuántos escribió,
+     *  regresa 0 únicamente al llegar al final de los datos.
+     *
+     * @tparam Reader   Tipo del Lector.
+     * @tparam CharType Tipo del caracter que se lee.
+     */
+    template <typename Reader, typename CharType>
+    concept ReaderFor = // clang-format off
+      std::movable<Reader> and requires(Reader& reader, CharType* buffer, size_t count)
+      {
+        { reader.Read(buffer, count) } -> std::same_as<size_t>;
+      }; // clang-format on
+
+    /**
+     * @brief Concepto que verifica que una referencia se convierta a std::basic_string_view<CharType, TraitType> sin que la
+     *        vista apunte a un objeto temporal: una referencia lvalue, un rango prestado (std::string_view) ó un puntero.
+     *
+     *  Excluye, por ejemplo, un std::string regresado por valor, que se destruye al terminar la expresión.
+     *
+     * @tparam Reference Tipo de la referencia, normalmente std::ranges::range_reference_t<Range>.
+     * @tparam CharType  Tipo del caracter de la vista.
+     * @tparam TraitType Tipo del std::char_traits<CharType> de la vista.
+     */
+    template <typename Reference, typename CharType, typename TraitType = std::char_traits<CharType>>
+    concept BorrowedStringView = std::convertible_to<Reference, std::basic_string_view<CharType, TraitType>> and //
+                                 (std::is_lvalue_reference_v<Reference> or std::ranges::borrowed_range<Reference> or std::is_pointer_v<Reference>);
+
+    /**
+     * @brief Concepto que verifica que un tipo de caracter pueda contener unidades de código UTF-8: char8_t ó char.
+     */
+    template <typename CharType>
+    concept Utf8CodeUnit = std::same_as<CharType, char8_t> or std::same_as<CharType, char>;
+
+    /**
+     * @brief Concepto que verifica que un tipo sea un caracter de texto: char, wchar_t, char8_t, char16_t ó char32_t.
+     */
+    template <typename CharType>
+    concept TextCharacter = Traits::IsAnyOf<CharType, char, wchar_t, char8_t, char16_t, char32_t>;
+
+    /**
+     * @brief Concepto que verifica que un caracter de texto tenga facet std::ctype en la biblioteca estándar: char ó wchar_t.
+     */
+    template <typename CharType>
+    concept LocaleCharacter = Traits::IsAnyOf<CharType, char, wchar_t>;
+
+    /**
+     * @brief Concepto que verifica que un tipo sea un rango contiguo de caracteres de texto que se puede modificar, por ejemplo
+     *        std::string ó std::vector<char>.
+     */
+    template <typename Range>
+    concept MutableTextRange = std::ranges::contiguous_range<Range> and std::ranges::sized_range<Range> and //
+                               TextCharacter<std::ranges::range_value_t<Range>> and                         //
+                               std::ranges::output_range<Range, std::ranges::range_value_t<Range>>;
+  } // namespace Concepts
+
+  namespace Algorithms
+  {
+    inline namespace V1
+    {
+      namespace Details
+      {
+        /**
+         * @brief Indica si un caracter es un espacio en blanco: ' ', '\t', '\n', '\v', '\f' ó '\r'.
+         */
+        template <typename CharType>
+        [[nodiscard]] inline constexpr bool IsWhiteSpace(const CharType character) noexcept;
+
+        /**
+         * @brief Aplica a un Token las opciones que modifican su contenido, es decir StringSplitOptions::TrimEntries.
+         */
+        template <StringSplitOptions Options, typename CharType, typename TraitType>
+        [[nodiscard]] inline constexpr std::basic_string_view<CharType, TraitType> ApplyTokenOptions(std::basic_string_view<CharType, TraitType> token) noexcept;
+
+        /**
+         * @brief Resultado de decodificar una secuencia UTF-8.
+         */
+        struct Utf8Sequence
+        {
+            /**
+             * @brief Punto de código decodificado, ó U+FFFD si la secuencia no es válida.
+             */
+            char32_t CodePoint;
+
+            /**
+             * @brief Cantidad de unidades de código consumidas: la secuencia completa, ó la parte inicial más larga que todavía
+             *        podía ser válida (sustitución de "maximal subparts" recomendada por Unicode), mínimo 1.
+             */
+            uint8_t Length;
+
+            bool Valid;
+        };
+
+        /**
+         * @brief Punto de código usado en lugar de las secuencias UTF-8 no válidas.
+         */
+        inline constexpr char32_t ReplacementCharacter = U'\uFFFD';
+
+        /**
+         * @brief Decodifica la secuencia UTF-8 que inicia en first, sin leer más allá de last. Requiere first != last.
+         */
+        template <typename CharType>
+        [[nodiscard]] inline constexpr Utf8Sequence DecodeUtf8(const CharType* first, const CharType* last) noexcept;
+
+        /**
+         * @brief Codifica un punto de código en UTF-8 y regresa la cantidad de unidades de código escritas en output (1 a 4).
+         *        Los sustitutos (U+D800 a U+DFFF) y los valores mayores que U+10FFFF se codifican como U+FFFD.
+         */
+        template <typename CharType>
+        inline constexpr size_t EncodeUtf8(char32_t code_point, CharType* output) noexcept;
+
+        /**
+         * @brief Posición de la primera secuencia UTF-8 no válida de [data, data + size), ó size si todo el texto es válido.
+         *
+         *  Usa el algoritmo de búsqueda en tablas de Keiser y Lemire con SSSE3 cuando el procesador lo admite (se detecta
+         *  en tiempo de ejecución) y un recorrido escalar con avance de 16 bytes ASCII en el resto de los casos.
+         */
+        [[nodiscard]] size_t FindInvalidUtf8(const unsigned char* data, size_t size) noexcept;
+
+        /**
+         * @brief Conversión que aplican ConvertCase, ToUpperCase y ToLowerCase.
+         */
+        enum class LetterCase : uint8_t
+        {
+          Upper,
+          Lower
+        };
+
+        /**
+         * @brief Convierte a mayúsculas ó minúsculas solo las letras ASCII de [input, input + size) y escribe el resultado en
+         *        output, que puede ser igual a input. Las demás unidades de código se copian sin cambios.
+         */
+        template <Concepts::TextCharacter CharType>
+        inline constexpr void ConvertAsciiCase(const CharType* input, CharType* output, size_t size, LetterCase letter_case) noexcept;
+
+        /**
+         * @brief Convierte [input, input + size) a mayúsculas ó minúsculas en output, que puede ser igual a input.
+         *
+         *  Usa el facet std::ctype del tipo de caracter de la configuración regional global, obtenido una sola vez en la primera
+         *  llamada: un std::locale::global posterior no cambia la conversión. Si el facet convierte las letras ASCII como la
+         *  configuración "C" (el caso habitual), el texto se convierte con SSE2 de 16 en 16 bytes y el facet solo se consulta
+         *  para las unidades de código no ASCII.
+         */
+        void ConvertCase(const char* input, char* output, size_t size, LetterCase letter_case);
+
+        /**
+         * @copydoc ConvertCase(const char*, char*, size_t, LetterCase)
+         */
+        void ConvertCase(const wchar_t* input, wchar_t* output, size_t size, LetterCase letter_case);
+
+        /**
+         * @brief Convierte [input, input + size) con el facet std::ctype de locale.
+         *
+         *  Si locale es la configuración que guardó la primera llamada se usa el mismo recorrido que sin locale; con cualquier
+         *  otra configuración el texto se convierte con una sola llamada al facet, sin construir tablas.
+         */
+        void ConvertCase(const char* input, char* output, size_t size, LetterCase letter_case, const std::locale& locale);
+
+        /**
+         * @copydoc ConvertCase(const char*, char*, size_t, LetterCase, const std::locale&)
+         */
+        void ConvertCase(const wchar_t* input, wchar_t* output, size_t size, LetterCase letter_case, const std::locale& locale);
+
+        /**
+         * @brief char8_t, char16_t y char32_t no tienen facet std::ctype: solo se convierten las letras ASCII.
+         */
+        template <Concepts::TextCharacter CharType>
+        inline constexpr void ConvertCase(const CharType* input, CharType* output, size_t size, LetterCase letter_case) noexcept;
+
+        /**
+         * @brief Forma de un caracter usada por las comparaciones sin distinción de mayúsculas y minúsculas: su minúscula según el
+         *        facet std::ctype del tipo de caracter, con las mismas reglas que ConvertCase.
+         */
+        [[nodiscard]] char FoldCase(char character);
+
+        /**
+         * @copydoc FoldCase(char)
+         */
+        [[nodiscard]] wchar_t FoldCase(wchar_t character);
+
+        /**
+         * @brief char8_t, char16_t y char32_t no tienen facet std::ctype: solo se convierten las letras ASCII.
+         */
+        template <Concepts::TextCharacter CharType>
+        [[nodiscard]] inline constexpr CharType FoldCase(CharType character) noexcept;
+
+        /**
+         * @brief Posición del primer caracter donde FoldCase(left[i]) != FoldCase(right[i]), ó size si son iguales.
+         *
+         *  Si el facet solo convierte las letras ASCII, compara 16 bytes por iteración con SSE2, en otro caso consulta la tabla
+         *  de minúsculas del facet por cada byte.
+         */
+        [[nodiscard]] size_t MismatchIgnoreCase(const char* left, const char* right, size_t size);
+
+        /**
+         * @brief Recorrido escalar con FoldCase para los demás tipos de caracter.
+         */
+        template <Concepts::TextCharacter CharType>
+        [[nodiscard]] inline constexpr size_t MismatchIgnoreCase(const CharType* left, const CharType* right, size_t size);
+
+        /**
+         * @brief Primera aparición de [pattern, pattern + pattern_size) en [first, last) sin distinguir mayúsculas y minúsculas,
+         *        ó last si no existe. Un Patrón vacío coincide en first.
+         *
+         *  Si el facet solo convierte las letras ASCII, cada iteración compara con SSE2 el primer y el último caracter del Patrón
+         *  con 16 posiciones candidatas del texto, y solo verifica el Patrón completo en las posiciones donde ambos coinciden.
+         */
+        [[nodiscard]] const char* SearchIgnoreCase(const char* first, const char* last, const char* pattern, size_t pattern_size);
+
+        /**
+         * @brief Recorrido escalar con FoldCase para los demás tipos de caracter.
+         */
+        template <Concepts::TextCharacter CharType>
+        [[nodiscard]] inline constexpr const CharType* SearchIgnoreCase(const CharType* first, const CharType* last, const CharType* pattern, size_t pattern_size);
+
+        /**
+         * @brief Copia de Text convertida con ConvertCase.
+         */
+        template <typename CharType, typename TraitType>
+        [[nodiscard]] inline std::basic_string<CharType, TraitType> ConvertedCase(std::basic_string_view<CharType, TraitType> text, LetterCase letter_case);
+
+        /**
+         * @brief Copia de Text convertida con el facet std::ctype de locale.
+         */
+        template <Concepts::LocaleCharacter CharType, typename TraitType>
+        [[nodiscard]] inline std::basic_string<CharType, TraitType> ConvertedCase(std::basic_string_view<CharType, TraitType> text, LetterCase letter_case, const std::locale& locale);
+      } // namespace Details
+    }   // namespace V1
+
+    namespace Searchers
+    {
+      /**
+       * @brief Buscador de un único caracter delimitador.
+       *
+       *  Sigue el mismo protocolo que std::default_searcher: recibe el rango [first, last) y regresa el par [inicio, fin)
+       *  de la siguiente coincidencia, o [last, last) si no existe ninguna.
+       *
+       *  La búsqueda se delega en TraitType::find, que para std::char_traits<char> y std::char_traits<wchar_t> se resuelve
+       *  en memchr/wmemchr: la librería de C ya los implementa con instrucciones SSE2/AVX2 seleccionadas en tiempo de ejecución.
+       *
+       * @tparam CharType  Tipo del caracter de la cadena.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <typename CharType, typename TraitType = std::char_traits<CharType>>
+      struct CharacterSearcher
+      {
+          CharType Delimiter;
+
+          [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> operator()(const CharType* first, const CharType* last) const noexcept;
+      };
+
+      /**
+       * @brief Buscador de cualquier caracter de un conjunto de delimitadores.
+       *
+       *  Al construirse genera una tabla de pertenencia de 256 entradas, de modo que la cadena se recorre una sola vez
+       *  con una consulta a la tabla por caracter, sin importar cuántos delimitadores tenga el conjunto.
+       *
+       *  Los delimitadores fuera del rango [0, 255] (wchar_t, char16_t, char32_t) se copian a un std::vector propio del
+       *  Buscador y se buscan en él, por lo que el conjunto puede ser temporal. Con caracteres de 1 byte basta la tabla y no
+       *  se reserva memoria.
+       *
+       * @tparam CharType  Tipo del caracter de la cadena.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <typename CharType, typename TraitType = std::char_traits<CharType>>
+      class AnyOfSearcher
+      {
+        public:
+          AnyOfSearcher() = default;
+          constexpr explicit AnyOfSearcher(std::basic_string_view<CharType, TraitType> delimiters) noexcept(sizeof(CharType) == 1);
+
+          [[nodiscard]] constexpr bool Contains(const CharType character) const noexcept;
+
+          [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> operator()(const CharType* first, const CharType* last) const noexcept;
+
+        private:
+          std::vector<CharType> m_Extended{};
+          std::array<bool, 256> m_Table{};
+      };
+
+      /**
+       * @brief Buscador de una subcadena para Patrones cortos.
+       *
+       *  Localiza el primer caracter del Patrón con TraitType::find (memchr) y solo entonces compara el resto del Patrón.
+       *
+       * @tparam CharType  Tipo del caracter de la cadena.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <typename CharType, typename TraitType = std::char_traits<CharType>>
+      struct SubstringSearcher
+      {
+          std::basic_string_view<CharType, TraitType> Pattern;
+
+          [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> operator()(const CharType* first, const CharType* last) const noexcept;
+      };
+
+      /**
+       * @brief Buscador de una subcadena con el algoritmo Boyer-Moore-Horspool.
+       *
+       *  La tabla de desplazamientos de 256 entradas se calcula una sola vez al construir el Buscador.
+       *  Para caracteres de más de un byte la tabla se indexa con el byte menos significativo, conservando el menor
+       *  desplazamiento de los caracteres que comparten entrada.
+       *
+       *  La tabla compara los caracteres por su valor, por lo que TraitType::eq debe ser una igualdad exacta.
+       *
+       * @tparam CharType  Tipo del caracter de la cadena.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <typename CharType, typename TraitType = std::char_traits<CharType>>
+      class HorspoolSearcher
+      {
+        public:
+          HorspoolSearcher() = default;
+          constexpr explicit HorspoolSearcher(std::basic_string_view<CharType, TraitType> pattern) noexcept;
+
+          [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> operator()(const CharType* first, const CharType* last) const noexcept;
+
+        private:
+          [[nodiscard]] inline static constexpr size_t TableIndex(const CharType character) noexcept;
+
+          std::basic_string_view<CharType, TraitType> m_Pattern{};
+          std::array<size_t, 256>                     m_Shifts{};
+      };
+
+      /**
+       * @brief Buscador usado por Split que elige el algoritmo según la longitud del Patrón.
+       *
+       *  - 1 caracter: CharacterSearcher.
+       *  - Menos de HorspoolThreshold caracteres: SubstringSearcher.
+       *  - HorspoolThreshold caracteres o más: HorspoolSearcher.
+       *
+       *  Si TraitType no es std::char_traits<CharType> siempre se usa SubstringSearcher, ya que es el único que respeta TraitType::eq.
+       *
+       * @tparam CharType  Tipo del caracter de la cadena.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <typename CharType, typename TraitType = std::char_traits<CharType>>
+      class PatternSearcher
+      {
+        public:
+          /**
+           * @brief Longitud mínima del Patrón a partir de la cual se usa Boyer-Moore-Horspool.
+           */
+          inline static constexpr size_t HorspoolThreshold = 8;
+
+          PatternSearcher() = default;
+          constexpr explicit PatternSearcher(std::basic_string_view<CharType, TraitType> pattern) noexcept;
+
+          [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> operator()(const CharType* first, const CharType* last) const noexcept;
+
+        private:
+          enum class Strategy
+          {
+            Character,
+            Substring,
+            Horspool
+          };
+
+          [[nodiscard]] inline static constexpr Strategy SelectStrategy(std::basic_string_view<CharType, TraitType> pattern) noexcept;
+
+          Strategy                                    m_Strategy{ Strategy::Substring };
+          std::basic_string_view<CharType, TraitType> m_Pattern{};
+          HorspoolSearcher<CharType, TraitType>       m_Horspool{};
+      };
+
+      /**
+       * @brief Buscador de una subcadena sin distinguir mayúsculas y minúsculas, por ejemplo:
+       *        Split(Headers, Searchers::CaseInsensitiveSearcher{ "\r\nContent-Type:"sv }).
+       *
+       *  Los caracteres se comparan con Details::FoldCase. Para char, las posiciones candidatas se filtran con SSE2 comparando
+       *  el primer y el último caracter del Patrón con 16 posiciones a la vez; el facet solo se consulta para los textos que no
+       *  son ASCII cuando la configuración regional global convierte otros caracteres además de las letras ASCII.
+       *
+       * @tparam CharType  Tipo del caracter de la cadena.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <Concepts::TextCharacter CharType, typename TraitType = std::char_traits<CharType>>
+      struct CaseInsensitiveSearcher
+      {
+          std::basic_string_view<CharType, TraitType> Pattern;
+
+          [[nodiscard]] std::pair<const CharType*, const CharType*> operator()(const CharType* first, const CharType* last) const;
+      };
+
+      template <typename CharType, typename TraitType>
+      CaseInsensitiveSearcher(std::basic_string_view<CharType, TraitType>) -> CaseInsensitiveSearcher<CharType, TraitType>;
+
+      /**
+       * @brief Buscador de un punto de código Unicode dentro de un texto UTF-8.
+       *
+       *  El punto de código se codifica una sola vez en sus 1 a 4 unidades de código. Como UTF-8 se sincroniza solo, una
+       *  coincidencia de esas unidades en un texto válido siempre inicia en el límite de un punto de código: basta con
+       *  localizar la primera unidad con TraitType::find (memchr) y comparar el resto, sin decodificar el texto.
+       *
+       * @tparam CharType  Tipo de la unidad de código UTF-8 de la cadena: char8_t ó char.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <Concepts::Utf8CodeUnit CharType, typename TraitType = std::char_traits<CharType>>
+      class CodePointSearcher
+      {
+        public:
+          CodePointSearcher() = default;
+          constexpr explicit CodePointSearcher(char32_t code_point) noexcept;
+
+          [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> operator()(const CharType* first, const CharType* last) const noexcept;
+
+        private:
+          std::array<CharType, 4> m_Units{};
+          size_t                  m_Size{ 0 };
+      };
+    } // namespace Searchers
+
+    namespace Readers
+    {
+      /**
+       * @brief Lector que obtiene los caracteres de un std::basic_istream<CharType, TraitType>.
+       *
+       *  Lee bloques completos con std::basic_istream::read, sin pasar por los operadores de extracción.
+       *  Si el flujo queda en estado bad(), se lanza un Cxx::IOException.
+       *
+       * @tparam CharType  Tipo del caracter del flujo.
+       * @tparam TraitType Tipo del std::char_traits<CharType> del flujo.
+       */
+      template <typename CharType, typename TraitType = std::char_traits<CharType>>
+      class StreamReader
+      {
+        public:
+          constexpr explicit StreamReader(std::basic_istream<CharType, TraitType>& stream) noexcept;
+
+          [[nodiscard]] size_t Read(CharType* buffer, size_t count);
+
+        private:
+          std::basic_istream<CharType, TraitType>* m_Stream;
+      };
+
+      /**
+       * @brief Lector que obtiene los bytes de un descriptor de archivo (archivo, tubería o socket).
+       *
+       *  No toma posesión del descriptor, por lo que no lo cierra. Las lecturas interrumpidas por una señal (EINTR) se reintentan,
+       *  cualquier otro error se reporta con un Cxx::IOException que contiene el std::error_code del sistema.
+       */
+      class FileDescriptorReader
+      {
+        public:
+          constexpr explicit FileDescriptorReader(int32_t file_descriptor) noexcept
+            : m_FileDescriptor{ file_descriptor }
+          {
+          }
+
+          [[nodiscard]] size_t Read(char* buffer, size_t count);
+
+        private:
+          int32_t m_FileDescriptor;
+      };
+    } // namespace Readers
+
     namespace Views
     {
       /**
@@ -285,63 +822,1840 @@ namespace Cxx
       };
 
       inline constexpr ValuesToStringViewAdaptorClosure ValuesToStringView{};
-    } // namespace Views
 
-  } // namespace Algorithms
+      /**
+       * @brief Vista perezosa de los puntos de código (char32_t) de un texto UTF-8.
+       *
+       *  Cada secuencia no válida produce U+FFFD y avanza la parte inicial más larga que todavía podía ser válida, igual que
+       *  los decodificadores de los navegadores, por lo que puede recorrer texto no confiable sin validarlo antes.
+       *  Iterator::base() regresa la posición de la secuencia en el texto original.
+       *
+       * @tparam CharType  Tipo de la unidad de código UTF-8 de la cadena: char8_t ó char.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       */
+      template <Concepts::Utf8CodeUnit CharType, typename TraitType = std::char_traits<CharType>>
+      class CodePointView : public std::ranges::view_interface<CodePointView<CharType, TraitType>>
+      {
+        public:
+          using string_view_type = std::basic_string_view<CharType, TraitType>;
+          using const_pointer    = const CharType*;
 
-  namespace Views = Algorithms::Views;
-} // namespace Cxx
+          class Iterator
+          {
+            public:
+              using iterator_concept  = std::forward_iterator_tag;
+              using iterator_category = std::input_iterator_tag;
+              using value_type        = char32_t;
+              using difference_type   = std::ptrdiff_t;
 
-namespace Cxx::Algorithms::inline V1
-{
-  /**
-   * @brief Convierte un contenedor en una cadena donde cada elemento está separado por un delimitador.
-   *
-   * @tparam ContainerType El tipo del input_container que contiene todos los elementos a unir en una cadena.
-   * @tparam SeparatorType El tipo del separador usado para cada elemento del container.
-   * @tparam CharType  El tipo del caracter del objeto string que se usará como retorno.
-   * @tparam TraitType El tipo del std::char_trait<CharType> del objeto string que se usará como retorno.
-   * @tparam AllocType El tipo del std::allocator<CharType> del objeto string que se usará como retorno.
-   *
-   * @param[in] container  Referencia del del input_container que contiene los elementos a unir en una cadena.
-   * @param[in] separator  Referencia del separador de cada elemento del container.
-   *
-   * @return Regresa en un string todos los valores del contenedor separados por un delimitador.
-   */
-  template <typename CharType = char, typename TraitType = std::char_traits<CharType>, typename AllocType = std::allocator<CharType>>
-  std::basic_string<CharType, TraitType, AllocType> Join(auto&& container, auto&& separator);
+              Iterator() = default;
+              constexpr Iterator(const_pointer current, const_pointer last) noexcept;
+
+              [[nodiscard]] constexpr value_type operator*() const noexcept;
+
+              constexpr Iterator& operator++() noexcept;
+              constexpr Iterator  operator++(int32_t) noexcept;
+
+              [[nodiscard]] constexpr bool operator==(const Iterator& right) const noexcept;
+
+              /**
+               * @brief Posición en el texto original de la primera unidad de código del punto de código actual.
+               */
+              [[nodiscard]] constexpr const_pointer base() const noexcept;
+
+              /**
+               * @brief Unidades de código del punto de código actual, tal como aparecen en el texto original.
+               */
+              [[nodiscard]] constexpr string_view_type Units() const noexcept;
+
+            private:
+              constexpr void Decode() noexcept;
+
+              const_pointer         m_Current{ nullptr };
+              const_pointer         m_Last{ nullptr };
+              Details::Utf8Sequence m_Sequence{};
+          };
+
+          CodePointView() = default;
+          constexpr explicit CodePointView(string_view_type text) noexcept;
+
+          [[nodiscard]] constexpr Iterator begin() const noexcept;
+          [[nodiscard]] constexpr Iterator end() const noexcept;
+
+          [[nodiscard]] constexpr string_view_type base() const noexcept;
+
+        private:
+          string_view_type m_Text{};
+      };
+
+      struct CodePointsAdaptorClosure : std::ranges::range_adaptor_closure<CodePointsAdaptorClosure>
+      {
+          template <Concepts::StringViewCompatible Text>
+          requires Concepts::Utf8CodeUnit<Traits::CharacterTypeOf<Text>>
+          [[nodiscard]] constexpr auto operator()(Text&& text) const noexcept
+          {
+            using CharType  = Traits::CharacterTypeOf<Text>;
+            using TraitType = Traits::CharacterTraitsOf<Text>;
+
+            return CodePointView<CharType, TraitType>{ std::basic_string_view<CharType, TraitType>{ text } };
+          }
+      };
+
+      /**
+       * @brief Adaptador de rango que produce una Views::CodePointView, por ejemplo: u8"año"_zs | Views::CodePoints.
+       */
+      inline constexpr CodePointsAdaptorClosure CodePoints{};
+
+      /**
+       * @brief Vista perezosa del resultado de Join como una secuencia de fragmentos std::span<const CharType>:
+       *        elemento, separador, elemento, separador, ..., elemento.
+       *
+       *  No copia los elementos en una cadena nueva: cada fragmento apunta al elemento original ó al separador guardado en la
+       *  vista, por lo que puede entregarse directamente a una escritura vectorizada (writev) con WriteChunks. Los fragmentos
+       *  de los elementos son válidos mientras existan los elementos, y los del separador mientras exista la vista.
+       *
+       *  Concatenar todos los fragmentos produce la misma cadena que Join(Range, Separator).
+       *
+       * @tparam View      Vista cuyas referencias se pueden convertir a std::basic_string_view<CharType, TraitType> sin apuntar
+       *                   a un temporal (Concepts::BorrowedStringView).
+       * @tparam CharType  Tipo del caracter de los elementos y del separador.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de los elementos y del separador.
+       */
+      template <std::ranges::input_range View, typename CharType, typename TraitType = std::char_traits<CharType>>
+      requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+      class JoinWithView : public std::ranges::view_interface<JoinWithView<View, CharType, TraitType>>
+      {
+        public:
+          using chunk_type = std::span<const CharType>;
+
+          class Iterator
+          {
+            public:
+              using iterator_concept  = std::conditional_t<std::ranges::forward_range<View>, std::forward_iterator_tag, std::input_iterator_tag>;
+              using iterator_category = std::input_iterator_tag;
+              using value_type        = chunk_type;
+              using difference_type   = std::ptrdiff_t;
+
+              Iterator() = default;
+              constexpr Iterator(JoinWithView& parent, std::ranges::iterator_t<View> current);
+
+              [[nodiscard]] constexpr value_type operator*() const;
+
+              constexpr Iterator& operator++();
+              constexpr Iterator  operator++(int32_t);
+
+              [[nodiscard]] constexpr bool operator==(const Iterator& right) const requires std::equality_comparable<std::ranges::iterator_t<View>>;
+              [[nodiscard]] constexpr bool operator==(std::default_sentinel_t) const;
+
+            private:
+              JoinWithView*                 m_Parent{ nullptr };
+              std::ranges::iterator_t<View> m_Current{};
+              bool                          m_OnSeparator{ false };
+          };
+
+          JoinWithView() requires std::default_initializable<View> = default;
+          constexpr JoinWithView(View base, std::basic_string<CharType, TraitType> separator);
+
+          [[nodiscard]] constexpr Iterator begin();
+
+          [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+          {
+            return std::default_sentinel;
+          }
+
+          [[nodiscard]] constexpr View base() const& requires std::copy_constructible<View>;
+
+        private:
+          View                                   m_Base{};
+          std::basic_string<CharType, TraitType> m_Separator{};
+      };
+
+      template <typename CharType, typename TraitType>
+      struct JoinWithAdaptorClosure : std::ranges::range_adaptor_closure<JoinWithAdaptorClosure<CharType, TraitType>>
+      {
+          std::basic_string<CharType, TraitType> Separator;
+
+          template <std::ranges::viewable_range Range>
+          requires Concepts::BorrowedStringView<std::ranges::range_reference_t<Range>, CharType, TraitType>
+          [[nodiscard]] constexpr auto operator()(Range&& range) const
+          {
+            return JoinWithView<std::views::all_t<Range>, CharType, TraitType>{ std::views::all(std::forward<Range>(range)), Separator };
+          }
+      };
+
+      struct JoinWithAdaptor
+      {
+          template <Concepts::StringViewCompatible Separator>
+          [[nodiscard]] constexpr auto operator()(Separator&& separator) const
+          {
+            using CharType  = Traits::CharacterTypeOf<Separator>;
+            using TraitType = Traits::CharacterTraitsOf<Separator>;
+
+            return JoinWithAdaptorClosure<CharType, TraitType>{ {}, std::basic_string<CharType, TraitType>{ std::basic_string_view<CharType, TraitType>{ separator } } };
+          }
+
+          template <Concepts::Character CharType>
+          [[nodiscard]] constexpr auto operator()(const CharType separator) const
+          {
+            return JoinWithAdaptorClosure<CharType, std::char_traits<CharType>>{ {}, std::basic_string<CharType>(1, separator) };
+          }
+
+          template <std::ranges::viewable_range Range, typename Separator>
+          [[nodiscard]] constexpr auto operator()(Range&& range, Separator&& separator) const
+          requires std::invocable<const JoinWithAdaptor&, Separator> and std::invocable<std::invoke_result_t<const JoinWithAdaptor&, Separator>, Range>
+          {
+            return (*this)(std::forward<Separator>(separator))(std::forward<Range>(range));
+          }
+      };
+
+      /**
+       * @brief Adaptador de rango que produce una Views::JoinWithView, por ejemplo: Words | Views::JoinWith(", ")
+       *        ó Views::JoinWith(Words, '\n').
+       */
+      inline constexpr JoinWithAdaptor JoinWith{};
+
+      /**
+       * @brief Vista perezosa que separa una cadena en Tokens usando un Buscador (Searcher) para localizar cada delimitador.
+       *
+       *  Produce directamente objetos std::basic_string_view<CharType, TraitType>, con la misma semántica que std::views::split:
+       *  una cadena vacía no produce Tokens y un delimitador al final produce un Token vacío.
+       *
+       *  Las opciones se aplican durante el mismo recorrido, sin necesidad de un std::views::transform, std::views::filter
+       *  ó std::views::take adicional:
+       *
+       *  - StringSplitOptions::RemoveEmptyEntries omite los Tokens vacíos.
+       *  - StringSplitOptions::TrimEntries elimina los espacios en blanco al inicio y al final de cada Token.
+       *  - max_count limita la cantidad de Tokens: el último Token contiene el resto de la cadena sin separar.
+       *
+       * @tparam CharType  Tipo del caracter de la cadena.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+       * @tparam Searcher  Buscador con el protocolo de std::default_searcher sobre punteros a CharType.
+       * @tparam Options   Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+       */
+      template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+      class SplitView : public std::ranges::view_interface<SplitView<CharType, TraitType, Searcher, Options>>
+      {
+        public:
+          using string_view_type = std::basic_string_view<CharType, TraitType>;
+          using const_pointer    = const CharType*;
+          using match_type       = std::pair<const_pointer, const_pointer>;
+
+          class Iterator
+          {
+            public:
+              using iterator_concept  = std::forward_iterator_tag;
+              using iterator_category = std::input_iterator_tag;
+              using value_type        = string_view_type;
+              using difference_type   = std::ptrdiff_t;
+
+              Iterator() = default;
+              constexpr Iterator(const SplitView& parent, const_pointer current, match_type next, bool trailing_empty, size_t remaining) noexcept;
+
+              [[nodiscard]] constexpr value_type operator*() const noexcept;
+
+              constexpr Iterator& operator++();
+              constexpr Iterator  operator++(int32_t);
+
+              [[nodiscard]] constexpr bool operator==(const Iterator& right) const noexcept;
+
+            private:
+              constexpr void Advance();
+              constexpr void SkipEmptyEntries();
+              constexpr void ApplyMaxCount() noexcept;
+
+              const SplitView* m_Parent{ nullptr };
+              const_pointer    m_Current{ nullptr };
+              match_type       m_Next{ nullptr, nullptr };
+              bool             m_TrailingEmpty{ false };
+              size_t           m_Remaining{ 0 };
+          };
+
+          SplitView() requires std::default_initializable<Searcher> = default;
+          constexpr SplitView(string_view_type text, Searcher searcher, size_t max_count = UnlimitedCount) noexcept(std::is_nothrow_move_constructible_v<Searcher>);
+
+          [[nodiscard]] constexpr Iterator begin() const;
+          [[nodiscard]] constexpr Iterator end() const noexcept;
+
+          [[nodiscard]] constexpr string_view_type base() const noexcept;
+
+        private:
+          constexpr match_type FindNext(const_pointer position) const;
+
+          string_view_type m_Text{};
+          Searcher         m_Searcher{};
+          size_t           m_MaxCount{ UnlimitedCount };
+      };
+
+      /**
+       * @brief Vista de un solo recorrido que separa en Tokens los caracteres de un Lector, usando un buffer de tamaño fijo.
+       *
+       *  El buffer se reserva una sola vez y se reutiliza: cuando el Buscador llega al final de los datos disponibles, el Token
+       *  incompleto se mueve al inicio del buffer y el resto se vuelve a llenar con el Lector. De esta forma la memoria usada no
+       *  depende del tamaño total de los datos, sino únicamente de buffer_size.
+       *
+       *  Cada Token es un std::basic_string_view que apunta al buffer interno y solo es válido hasta el siguiente incremento
+       *  del iterador. Si un Token (más el delimitador que lo termina) no cabe en el buffer, se lanza un Cxx::IOException con
+       *  std::errc::value_too_large.
+       *
+       *  Produce los mismos Tokens que Views::SplitView aplicado a todos los datos.
+       *
+       * @tparam CharType  Tipo del caracter de los datos.
+       * @tparam TraitType Tipo del std::char_traits<CharType> de los datos.
+       * @tparam Reader    Lector con el protocolo de Concepts::ReaderFor.
+       * @tparam Searcher  Buscador con el protocolo de std::default_searcher sobre punteros a CharType.
+       * @tparam Options   Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+       */
+      template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+      class StreamSplitView : public std::ranges::view_interface<StreamSplitView<CharType, TraitType, Reader, Searcher, Options>>
+      {
+        public:
+          using string_view_type = std::basic_string_view<CharType, TraitType>;
+
+          class Iterator
+          {
+            public:
+              using iterator_concept = std::input_iterator_tag;
+              using value_type       = string_view_type;
+              using difference_type  = std::ptrdiff_t;
+
+              constexpr explicit Iterator(StreamSplitView& parent) noexcept;
+
+              [[nodiscard]] value_type operator*() const noexcept;
+
+              Iterator& operator++();
+              void      operator++(int32_t);
+
+              [[nodiscard]] bool operator==(std::default_sentinel_t) const noexcept;
+
+            private:
+              StreamSplitView* m_Parent;
+          };
+
+          /**
+           * @param[in] reader      Lector del que se obtienen los caracteres.
+           * @param[in] searcher    Buscador que localiza cada delimitador.
+           * @param[in] overlap     Cantidad de caracteres que un delimitador puede ocupar antes del final de los datos disponibles
+           *                        sin haber sido detectado (longitud del Patrón menos 1). Evita volver a buscar desde el inicio del Token.
+           * @param[in] buffer_size Tamaño del buffer en caracteres.
+           */
+          StreamSplitView(Reader reader, Searcher searcher, size_t overlap, size_t buffer_size = DefaultStreamBufferSize);
+
+          [[nodiscard]] Iterator begin();
+
+          [[nodiscard]] constexpr std::default_sentinel_t end() const noexcept
+          {
+            return std::default_sentinel;
+          }
+
+        private:
+          bool Next();
+          void Refill();
+
+          Reader                      m_Reader;
+          Searcher                    m_Searcher;
+          size_t                      m_Overlap;
+          size_t                      m_Capacity;
+          std::unique_ptr<CharType[]> m_Buffer;
+          size_t                      m_First{ 0 };
+          size_t                      m_Scan{ 0 };
+          size_t                      m_Last{ 0 };
+          string_view_type            m_Token{};
+          bool                        m_EndOfData{ false };
+          bool                        m_AfterDelimiter{ false };
+          bool                        m_HasToken{ false };
+      };
+    } // namespace Views
+
+  } // namespace Algorithms
+
+  namespace Views = Algorithms::Views;
+} // namespace Cxx
+
+namespace Cxx::Algorithms::inline V1
+{
+  namespace Details
+  {
+    /**
+     * @brief Concepto que verifica que los elementos de un Rango y el separador se puedan copiar directamente como cadenas,
+     *        sin formatearlos con un std::basic_ostream.
+     */
+    template <typename Range, typename Separator, typename CharType, typename TraitType>
+    concept StringJoinable =                                                                                     //
+      std::convertible_to<std::ranges::range_reference_t<Range>, std::basic_string_view<CharType, TraitType>> and //
+      (std::convertible_to<Separator, std::basic_string_view<CharType, TraitType>> or std::same_as<std::remove_cvref_t<Separator>, CharType>);
+
+    /**
+     * @brief Concepto que verifica que los elementos de un Rango sean números que se pueden formatear con std::to_chars.
+     *
+     *  Se excluyen bool y los tipos de caracter (incluidos signed char y unsigned char), que operator<< no escribe como números.
+     */
+    template <typename Range, typename Separator, typename CharType, typename TraitType>
+    concept NumberJoinable =                                                                                                                                           //
+      (std::integral<std::ranges::range_value_t<Range>> or std::floating_point<std::ranges::range_value_t<Range>>) and                                                //
+      (not Traits::IsAnyOf<std::ranges::range_value_t<Range>, bool, char, signed char, unsigned char, wchar_t, char8_t, char16_t, char32_t>) and                   //
+      (std::convertible_to<Separator, std::basic_string_view<CharType, TraitType>> or std::same_as<std::remove_cvref_t<Separator>, CharType>);
+
+    /**
+     * @brief Cantidad de dígitos decimales de un número entero, incluido el signo '-'.
+     */
+    template <std::integral Integer>
+    [[nodiscard]] inline constexpr size_t DecimalLength(const Integer value) noexcept;
+
+    /**
+     * @brief Agrega a output los números unidos, formateados con std::to_chars sin usar un std::basic_ostream.
+     *
+     *  Para enteros de un forward_range cuyos elementos son referencias lvalue, la longitud exacta se calcula a partir de la
+     *  cantidad de dígitos de cada número, se reserva una sola vez y std::to_chars escribe directamente en output.
+     */
+    template <typename CharType, typename TraitType, typename AllocType>
+    void AppendJoinedNumbers(std::basic_string<CharType, TraitType, AllocType>& output, std::ranges::input_range auto&& container, std::basic_string_view<CharType, TraitType> separator);
+
+    /**
+     * @brief Concepto que verifica que un iterador de salida reciba cada elemento y separador como un std::basic_string_view
+     *        completo, por ejemplo un OutputIteratorAdapter de una función void(std::string_view).
+     */
+    template <typename OutputIterator, typename CharType, typename TraitType>
+    concept StringViewOutputIterator = std::output_iterator<OutputIterator, std::basic_string_view<CharType, TraitType>>;
+
+    /**
+     * @brief Regresa el separador como un std::basic_string_view, un separador de tipo CharType es una cadena de longitud 1.
+     */
+    template <typename CharType, typename TraitType>
+    [[nodiscard]] inline constexpr std::basic_string_view<CharType, TraitType> SeparatorView(const auto& separator) noexcept;
+
+    /**
+     * @brief Agrega a output las cadenas unidas, calculando primero la longitud exacta del resultado, de modo que se reserva
+     *        memoria una sola vez y cada elemento y separador se copia con TraitType::copy (memcpy).
+     *
+     *  La copia dentro de resize_and_overwrite solo se usa cuando los elementos son referencias lvalue ó std::basic_string_view;
+     *  los elementos que se construyen al recorrer el rango (std::views::transform que regresa std::string) se agregan con append.
+     */
+    template <typename CharType, typename TraitType, typename AllocType>
+    void AppendJoinedStrings(std::basic_string<CharType, TraitType, AllocType>& output, std::ranges::input_range auto&& container, std::basic_string_view<CharType, TraitType> separator);
+
+    /**
+     * @brief Escribe en un iterador de salida las cadenas unidas, por piezas si admite StringViewOutputIterator ó caracter por caracter.
+     */
+    template <typename CharType, typename TraitType, typename OutputIterator>
+    OutputIterator WriteJoinedStrings(OutputIterator output, std::ranges::input_range auto&& container, std::basic_string_view<CharType, TraitType> separator);
+  } // namespace Details
+
+  /**
+   * @brief Convierte un contenedor en una cadena donde cada elemento está separado por un delimitador.
+   *
+   *  Si los elementos y el separador son cadenas (Details::StringJoinable), el resultado se reserva una sola vez con su
+   *  longitud exacta y se copia con memcpy. Los números (Details::NumberJoinable) se formatean con std::to_chars: los enteros
+   *  también se reservan una sola vez, y los números de punto flotante usan la representación más corta que conserva su
+   *  valor (por ejemplo 0.1 ó 0.3333333333333333). El resto de los tipos se formatea con operator<< de un std::basic_ostringstream.
+   *
+   * @tparam ContainerType El tipo del input_container que contiene todos los elementos a unir en una cadena.
+   * @tparam SeparatorType El tipo del separador usado para cada elemento del container.
+   * @tparam CharType  El tipo del caracter del objeto string que se usará como retorno.
+   * @tparam TraitType El tipo del std::char_trait<CharType> del objeto string que se usará como retorno.
+   * @tparam AllocType El tipo del std::allocator<CharType> del objeto string que se usará como retorno.
+   *
+   * @param[in] container  Referencia del del input_container que contiene los elementos a unir en una cadena.
+   * @param[in] separator  Referencia del separador de cada elemento del container.
+   *
+   * @return Regresa en un string todos los valores del contenedor separados por un delimitador.
+   */
+  template <typename CharType = char, typename TraitType = std::char_traits<CharType>, typename AllocType = std::allocator<CharType>>
+  std::basic_string<CharType, TraitType, AllocType> Join(std::ranges::input_range auto&& container, auto&& separator);
+
+  /**
+   * @brief Agrega al final de una cadena existente los elementos de un contenedor separados por un delimitador.
+   *
+   *  A diferencia de Join no crea una cadena nueva: la capacidad de output se reutiliza, por lo que un mismo buffer por hilo
+   *  evita reservar memoria en cada llamada. El contenido previo de output se conserva.
+   *
+   * @param[in,out] output    Cadena a la que se agrega el resultado.
+   * @param[in]     container Referencia del input_container que contiene los elementos a unir en una cadena.
+   * @param[in]     separator Referencia del separador de cada elemento del container.
+   *
+   * @return Regresa la referencia de output.
+   */
+  template <typename CharType, typename TraitType, typename AllocType>
+  std::basic_string<CharType, TraitType, AllocType>& JoinInto(std::basic_string<CharType, TraitType, AllocType>& output, std::ranges::input_range auto&& container, auto&& separator);
+
+  /**
+   * @brief Escribe en un iterador de salida los elementos de un contenedor separados por un delimitador.
+   *
+   *  Si el iterador admite std::basic_string_view<CharType, TraitType> (por ejemplo un OutputIteratorAdapter de una función
+   *  void(std::string_view)), recibe cada elemento y cada separador como una sola pieza; en otro caso recibe caracter por caracter.
+   *
+   * @tparam CharType  El tipo del caracter de las cadenas.
+   * @tparam TraitType El tipo del std::char_trait<CharType> de las cadenas.
+   *
+   * @param[in] output    Iterador de salida donde se escribe el resultado.
+   * @param[in] container Referencia del input_container que contiene los elementos a unir en una cadena.
+   * @param[in] separator Referencia del separador de cada elemento del container.
+   *
+   * @return Regresa el iterador de salida después del último caracter escrito.
+   */
+  template <typename CharType = char, typename TraitType = std::char_traits<CharType>, typename OutputIterator>
+  requires std::output_iterator<OutputIterator, CharType> or Details::StringViewOutputIterator<OutputIterator, CharType, TraitType>
+  OutputIterator JoinInto(OutputIterator output, std::ranges::input_range auto&& container, auto&& separator);
+
+  namespace Details
+  {
+    /**
+     * @brief Escribe todos los fragmentos en el descriptor de archivo con writev, repitiendo la escritura hasta completarlos.
+     *
+     * @throws Cxx::IOException Con el std::error_code del sistema si la escritura falla.
+     */
+    void WriteChunks(int32_t file_descriptor, std::span<const std::span<const char>> chunks);
+  } // namespace Details
+
+  /**
+   * @brief Cantidad de fragmentos que WriteChunks entrega al sistema en cada llamada a writev (IOV_MAX es al menos 16 y en Linux 1024).
+   */
+  inline constexpr size_t WriteChunksBatchSize = 256;
+
+  /**
+   * @brief Tamaño del buffer donde WriteChunks acumula los fragmentos pequeños antes de entregarlos a writev.
+   */
+  inline constexpr size_t WriteChunksBufferSize = 16 * 1024;
+
+  /**
+   * @brief Los fragmentos con menos bytes que este límite se copian al buffer de WriteChunks en lugar de entregarse por separado.
+   */
+  inline constexpr size_t WriteChunksCopyThreshold = 512;
+
+  /**
+   * @brief Escribe un rango de fragmentos en un descriptor de archivo (archivo, tubería o socket) con escrituras vectorizadas.
+   *
+   *  Los fragmentos se agrupan en lotes de WriteChunksBatchSize que se entregan a writev en una sola llamada al sistema. Los
+   *  fragmentos grandes se entregan sin copiarlos; los consecutivos menores que WriteChunksCopyThreshold (separadores, campos
+   *  cortos) se copian a un buffer de WriteChunksBufferSize bytes y se entregan como un solo fragmento, para que el costo
+   *  de las llamadas al sistema no dependa de la cantidad de fragmentos. Por ejemplo:
+   *
+   *    WriteChunks(socket, Fields | Views::JoinWith(", "));
+   *
+   *  Un fragmento grande se guarda en el lote hasta la siguiente escritura, por lo que solo se difiere cuando sigue siendo
+   *  válido al avanzar el iterador: en un rango forward cuya referencia es lvalue ó prestada. En un rango de entrada
+   *  (std::views::istream) ó con fragmentos temporales, el lote se escribe antes de avanzar.
+   *
+   *  Las escrituras parciales y las interrumpidas por una señal (EINTR) se reintentan. En Windows cada fragmento se escribe con _write.
+   *
+   * @param[in] FileDescriptor Descriptor de archivo donde se escriben los fragmentos. No se cierra.
+   * @param[in] Chunks         Rango de fragmentos que se pueden convertir a std::span<const char>.
+   *
+   * @throws Cxx::IOException Con el std::error_code del sistema si la escritura falla.
+   *
+   * @return Regresa la cantidad total de bytes escritos.
+   */
+  template <std::ranges::input_range Range>
+  requires std::convertible_to<std::ranges::range_reference_t<Range>, std::span<const char>>
+  size_t WriteChunks(const int32_t FileDescriptor, Range&& Chunks);
+
+  /**
+   * @brief Separa una Cadena en una lista de Tokens según el Patrón indicado.
+   *
+   *  El algoritmo de búsqueda del Patrón se elige según su longitud con Searchers::PatternSearcher.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Text     Cadena que será separada en Tokens.
+   * @param[in] Pattern  Cadena usada como Patrón para separar la Cadena Text en Tokens.
+   * @param[in] MaxCount Cantidad máxima de Tokens, el último Token contiene el resto de la cadena sin separar.
+   *
+   * @return Regresa una lista de std::basic_string_view<CharType, TraitType> con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline constexpr auto Split(Concepts::StringViewCompatible auto&& Text, Concepts::StringViewCompatible auto&& Pattern, const size_t MaxCount = UnlimitedCount) noexcept
+  requires std::same_as<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTypeOf<decltype(Pattern)>>
+  {
+    using CharType   = Traits::CharacterTypeOf<decltype(Text)>;
+    using TraitType  = Traits::CharacterTraitsOf<decltype(Text)>;
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Searcher   = Searchers::PatternSearcher<CharType, TraitType>;
+
+    return Views::SplitView<CharType, TraitType, Searcher, Options>{ StringView{ Text }, Searcher{ StringView{ Pattern } }, MaxCount };
+  }
+
+  /**
+   * @brief Separa una Cadena en una lista de Tokens usando un Buscador (Searcher) para localizar cada delimitador.
+   *
+   *  Permite elegir explícitamente el algoritmo de búsqueda, por ejemplo: Split(Text, Searchers::HorspoolSearcher{ Pattern }).
+   *  El Buscador se prepara una sola vez y se reutiliza en cada búsqueda.
+   *
+   * @tparam Options  Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   * @tparam Searcher Buscador con el protocolo de std::default_searcher sobre punteros a CharType.
+   *
+   * @param[in] Text     Cadena que será separada en Tokens.
+   * @param[in] searcher Buscador que localiza cada delimitador.
+   * @param[in] MaxCount Cantidad máxima de Tokens, el último Token contiene el resto de la cadena sin separar.
+   *
+   * @return Regresa una vista perezosa de std::basic_string_view<CharType, TraitType> con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries, typename Searcher>
+  [[nodiscard]] inline constexpr auto Split(Concepts::StringViewCompatible auto&& Text, Searcher&& searcher, const size_t MaxCount = UnlimitedCount) noexcept(std::is_nothrow_constructible_v<std::remove_cvref_t<Searcher>, Searcher>)
+  requires Concepts::SearcherFor<std::remove_cvref_t<Searcher>, Traits::CharacterTypeOf<decltype(Text)>>
+  {
+    using CharType   = Traits::CharacterTypeOf<decltype(Text)>;
+    using TraitType  = Traits::CharacterTraitsOf<decltype(Text)>;
+    using StringView = std::basic_string_view<CharType, TraitType>;
+
+    return Views::SplitView<CharType, TraitType, std::remove_cvref_t<Searcher>, Options>{ StringView{ Text }, std::forward<Searcher>(searcher), MaxCount };
+  }
+
+  /**
+   * @brief Separa una Cadena en una lista de Tokens usando un único caracter como delimitador.
+   *
+   *  Cada delimitador se localiza con Searchers::CharacterSearcher (memchr/wmemchr) en lugar de comparar caracter por caracter.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Text      Cadena que será separada en Tokens.
+   * @param[in] Delimiter Caracter usado como delimitador para separar la Cadena Text en Tokens.
+   * @param[in] MaxCount  Cantidad máxima de Tokens, el último Token contiene el resto de la cadena sin separar.
+   *
+   * @return Regresa una vista perezosa de std::basic_string_view<CharType, TraitType> con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline constexpr auto Split(Concepts::StringViewCompatible auto&& Text, const Traits::CharacterTypeOf<decltype(Text)> Delimiter, const size_t MaxCount = UnlimitedCount) noexcept
+  {
+    using CharType   = Traits::CharacterTypeOf<decltype(Text)>;
+    using TraitType  = Traits::CharacterTraitsOf<decltype(Text)>;
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Searcher   = Searchers::CharacterSearcher<CharType, TraitType>;
+
+    return Views::SplitView<CharType, TraitType, Searcher, Options>{ StringView{ Text }, Searcher{ Delimiter }, MaxCount };
+  }
+
+  /**
+   * @brief Separa una Cadena en una lista de Tokens usando como delimitador cualquiera de los caracteres indicados.
+   *
+   *  Por ejemplo: SplitAny("a b\tc,d", " \t,") regresa { "a", "b", "c", "d" }.
+   *
+   *  La cadena se recorre una sola vez con Searchers::AnyOfSearcher y los Tokens vacíos se omiten dentro del mismo recorrido.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Text       Cadena que será separada en Tokens.
+   * @param[in] Delimiters Conjunto de caracteres donde cada uno de ellos separa la Cadena Text en Tokens.
+   * @param[in] MaxCount   Cantidad máxima de Tokens, el último Token contiene el resto de la cadena sin separar.
+   *
+   * @return Regresa una vista perezosa de std::basic_string_view<CharType, TraitType> con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline constexpr auto SplitAny(Concepts::StringViewCompatible auto&& Text, Concepts::StringViewCompatible auto&& Delimiters, const size_t MaxCount = UnlimitedCount) noexcept(sizeof(Traits::CharacterTypeOf<decltype(Text)>) == 1)
+  requires std::same_as<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTypeOf<decltype(Delimiters)>>
+  {
+    using CharType   = Traits::CharacterTypeOf<decltype(Text)>;
+    using TraitType  = Traits::CharacterTraitsOf<decltype(Text)>;
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Searcher   = Searchers::AnyOfSearcher<CharType, TraitType>;
+
+    return Views::SplitView<CharType, TraitType, Searcher, Options>{ StringView{ Text }, Searcher{ StringView{ Delimiters } }, MaxCount };
+  }
+
+  /**
+   * @brief Separa un texto UTF-8 en una lista de Tokens usando un punto de código Unicode como delimitador.
+   *
+   *  Por ejemplo: Split(u8"uno→dos→tres"sv, U'→') regresa { u8"uno", u8"dos", u8"tres" }.
+   *
+   *  El delimitador se busca con Searchers::CodePointSearcher sobre sus unidades de código, sin decodificar el texto.
+   *  Los delimitadores de 1 byte siguen usando memchr, igual que Split(Text, Delimiter).
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Text      Texto UTF-8 (char8_t ó char) que será separado en Tokens.
+   * @param[in] CodePoint Punto de código usado como delimitador, debe ser de tipo char32_t.
+   * @param[in] MaxCount  Cantidad máxima de Tokens, el último Token contiene el resto de la cadena sin separar.
+   *
+   * @return Regresa una vista perezosa de std::basic_string_view<CharType, TraitType> con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline constexpr auto Split(Concepts::StringViewCompatible auto&& Text, const std::same_as<char32_t> auto CodePoint, const size_t MaxCount = UnlimitedCount) noexcept
+  requires Concepts::Utf8CodeUnit<Traits::CharacterTypeOf<decltype(Text)>>
+  {
+    using CharType   = Traits::CharacterTypeOf<decltype(Text)>;
+    using TraitType  = Traits::CharacterTraitsOf<decltype(Text)>;
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Searcher   = Searchers::CodePointSearcher<CharType, TraitType>;
+
+    return Views::SplitView<CharType, TraitType, Searcher, Options>{ StringView{ Text }, Searcher{ CodePoint }, MaxCount };
+  }
+
+  /**
+   * @brief Resultado de ValidateUtf8.
+   */
+  struct Utf8ValidationResult
+  {
+      /**
+       * @brief Indica si todo el texto es UTF-8 válido.
+       */
+      bool Valid;
+
+      /**
+       * @brief Posición (en unidades de código) de la primera secuencia no válida, ó el tamaño del texto si es válido.
+       */
+      size_t Position;
+  };
+
+  /**
+   * @brief Valida que un texto sea UTF-8 bien formado: sin secuencias incompletas, sobrelargas, sustitutos (U+D800 a U+DFFF)
+   *        ni valores mayores que U+10FFFF.
+   *
+   *  Los bloques de 64 bytes se validan con SSSE3 cuando el procesador lo admite, y los bloques ASCII se descartan con una
+   *  sola comparación. Solo se recorre el texto de nuevo a partir del bloque con error, para obtener la posición exacta.
+   *
+   * @param[in] Text Texto UTF-8 (char8_t ó char) que será validado.
+   *
+   * @return Regresa si el texto es válido y la posición de la primera secuencia no válida.
+   */
+  [[nodiscard]] inline Utf8ValidationResult ValidateUtf8(Concepts::StringViewCompatible auto&& Text) noexcept
+  requires Concepts::Utf8CodeUnit<Traits::CharacterTypeOf<decltype(Text)>>
+  {
+    const std::basic_string_view<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTraitsOf<decltype(Text)>> text{ Text };
+
+    const size_t position = Details::FindInvalidUtf8(reinterpret_cast<const unsigned char*>(text.data()), text.size());
+    return Utf8ValidationResult{ position == text.size(), position };
+  }
+
+  /**
+   * @brief Indica si un texto es UTF-8 bien formado, @see ValidateUtf8.
+   */
+  [[nodiscard]] inline bool IsValidUtf8(Concepts::StringViewCompatible auto&& Text) noexcept
+  requires Concepts::Utf8CodeUnit<Traits::CharacterTypeOf<decltype(Text)>>
+  {
+    return ValidateUtf8(std::forward<decltype(Text)>(Text)).Valid;
+  }
+
+  /**
+   * @brief Regresa una copia del texto en mayúsculas.
+   *
+   *  Las letras ASCII se convierten con SSE2 y el resto de caracteres con el facet std::ctype de la configuración regional
+   *  global, obtenido una sola vez en la primera conversión del programa: si después se cambia con std::locale::global, se
+   *  debe pasar la configuración nueva a la sobrecarga que recibe un std::locale. char8_t, char16_t y char32_t solo convierten
+   *  las letras ASCII.
+   *
+   * @param[in] Text Texto que será convertido.
+   *
+   * @return Regresa una cadena nueva con el texto convertido.
+   */
+  template <Concepts::StringViewCompatible Text>
+  requires Concepts::TextCharacter<Traits::CharacterTypeOf<Text>>
+  [[nodiscard]] inline std::basic_string<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>> ToUpperCase(Text&& text)
+  {
+    return Details::ConvertedCase(std::basic_string_view<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>>{ text }, Details::LetterCase::Upper);
+  }
+
+  /**
+   * @brief Regresa una copia del texto en mayúsculas según el facet std::ctype de Locale.
+   *
+   * @param[in] Text   Texto que será convertido.
+   * @param[in] Locale Configuración regional de la conversión, por ejemplo la que se acaba de instalar con std::locale::global.
+   *
+   * @return Regresa una cadena nueva con el texto convertido.
+   */
+  template <Concepts::StringViewCompatible Text>
+  requires Concepts::LocaleCharacter<Traits::CharacterTypeOf<Text>>
+  [[nodiscard]] inline std::basic_string<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>> ToUpperCase(Text&& text, const std::locale& Locale)
+  {
+    return Details::ConvertedCase(std::basic_string_view<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>>{ text }, Details::LetterCase::Upper, Locale);
+  }
+
+  /**
+   * @brief Regresa una copia del texto en minúsculas, @see ToUpperCase.
+   */
+  template <Concepts::StringViewCompatible Text>
+  requires Concepts::TextCharacter<Traits::CharacterTypeOf<Text>>
+  [[nodiscard]] inline std::basic_string<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>> ToLowerCase(Text&& text)
+  {
+    return Details::ConvertedCase(std::basic_string_view<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>>{ text }, Details::LetterCase::Lower);
+  }
+
+  /**
+   * @brief Regresa una copia del texto en minúsculas según el facet std::ctype de Locale, @see ToUpperCase.
+   */
+  template <Concepts::StringViewCompatible Text>
+  requires Concepts::LocaleCharacter<Traits::CharacterTypeOf<Text>>
+  [[nodiscard]] inline std::basic_string<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>> ToLowerCase(Text&& text, const std::locale& Locale)
+  {
+    return Details::ConvertedCase(std::basic_string_view<Traits::CharacterTypeOf<Text>, Traits::CharacterTraitsOf<Text>>{ text }, Details::LetterCase::Lower, Locale);
+  }
+
+  /**
+   * @brief Convierte el texto a mayúsculas sin copiarlo, @see ToUpperCase.
+   *
+   * @param[in,out] Text Rango contiguo de caracteres que será modificado.
+   *
+   * @return Regresa la referencia de Text.
+   */
+  template <Concepts::MutableTextRange Range>
+  inline Range& ToUpperCaseInPlace(Range& Text)
+  {
+    Details::ConvertCase(std::ranges::data(Text), std::ranges::data(Text), std::ranges::size(Text), Details::LetterCase::Upper);
+    return Text;
+  }
+
+  /**
+   * @brief Convierte el texto a minúsculas sin copiarlo, @see ToUpperCase.
+   *
+   * @param[in,out] Text Rango contiguo de caracteres que será modificado.
+   *
+   * @return Regresa la referencia de Text.
+   */
+  template <Concepts::MutableTextRange Range>
+  inline Range& ToLowerCaseInPlace(Range& Text)
+  {
+    Details::ConvertCase(std::ranges::data(Text), std::ranges::data(Text), std::ranges::size(Text), Details::LetterCase::Lower);
+    return Text;
+  }
+
+  /**
+   * @brief Convierte el texto a mayúsculas sin copiarlo según el facet std::ctype de Locale, @see ToUpperCase.
+   *
+   * @param[in,out] Text   Rango contiguo de caracteres que será modificado.
+   * @param[in]     Locale Configuración regional de la conversión.
+   *
+   * @return Regresa la referencia de Text.
+   */
+  template <Concepts::MutableTextRange Range>
+  requires Concepts::LocaleCharacter<std::ranges::range_value_t<Range>>
+  inline Range& ToUpperCaseInPlace(Range& Text, const std::locale& Locale)
+  {
+    Details::ConvertCase(std::ranges::data(Text), std::ranges::data(Text), std::ranges::size(Text), Details::LetterCase::Upper, Locale);
+    return Text;
+  }
+
+  /**
+   * @brief Convierte el texto a minúsculas sin copiarlo según el facet std::ctype de Locale, @see ToUpperCase.
+   *
+   * @param[in,out] Text   Rango contiguo de caracteres que será modificado.
+   * @param[in]     Locale Configuración regional de la conversión.
+   *
+   * @return Regresa la referencia de Text.
+   */
+  template <Concepts::MutableTextRange Range>
+  requires Concepts::LocaleCharacter<std::ranges::range_value_t<Range>>
+  inline Range& ToLowerCaseInPlace(Range& Text, const std::locale& Locale)
+  {
+    Details::ConvertCase(std::ranges::data(Text), std::ranges::data(Text), std::ranges::size(Text), Details::LetterCase::Lower, Locale);
+    return Text;
+  }
+
+  /**
+   * @brief Resultado de SplitInto.
+   */
+  struct SplitIntoResult
+  {
+      /**
+       * @brief Cantidad de Tokens escritos en el span de salida.
+       */
+      size_t Count;
+
+      /**
+       * @brief Indica si la cadena tenía más Tokens de los que caben en el span de salida.
+       */
+      bool Overflow;
+
+      [[nodiscard]] friend constexpr bool operator==(const SplitIntoResult&, const SplitIntoResult&) noexcept = default;
+  };
+
+  namespace Details
+  {
+    /**
+     * @brief Escribe los Tokens de la vista en Out hasta llenarlo.
+     */
+    template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+    [[nodiscard]] inline constexpr SplitIntoResult SplitIntoSpan(const Views::SplitView<CharType, TraitType, Searcher, Options>& tokens, const std::span<std::basic_string_view<CharType, TraitType>> Out) noexcept
+    {
+      size_t count = 0;
+
+      for ( const std::basic_string_view<CharType, TraitType> token : tokens )
+      {
+        if ( count == Out.size() )
+        {
+          return SplitIntoResult{ count, true };
+        }
+
+        Out[count++] = token;
+      }
+
+      return SplitIntoResult{ count, false };
+    }
+  } // namespace Details
+
+  /**
+   * @brief Separa una Cadena en Tokens y los escribe en un span proporcionado por el usuario, sin reservar memoria.
+   *
+   *  Por ejemplo:
+   *
+   *    std::array<std::string_view, 16> fields;
+   *    const auto [count, overflow] = SplitInto(request_line, " ", fields);
+   *
+   *  Si la cadena tiene más Tokens que el tamaño de Out, se escriben los primeros Out.size() Tokens y Overflow es true.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in]  Text    Cadena que será separada en Tokens.
+   * @param[in]  Pattern Cadena usada como Patrón para separar la Cadena Text en Tokens.
+   * @param[out] Out     Espacio donde se escriben los Tokens.
+   *
+   * @return Regresa la cantidad de Tokens escritos y si quedaron Tokens sin escribir.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline constexpr SplitIntoResult SplitInto(Concepts::StringViewCompatible auto&& Text, Concepts::StringViewCompatible auto&& Pattern, const std::span<std::basic_string_view<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTraitsOf<decltype(Text)>>> Out) noexcept
+  requires std::same_as<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTypeOf<decltype(Pattern)>>
+  {
+    return Details::SplitIntoSpan(Split<Options>(std::forward<decltype(Text)>(Text), std::forward<decltype(Pattern)>(Pattern)), Out);
+  }
+
+  /**
+   * @brief Separa una Cadena en Tokens usando un único caracter como delimitador y los escribe en un span, sin reservar memoria.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in]  Text      Cadena que será separada en Tokens.
+   * @param[in]  Delimiter Caracter usado como delimitador para separar la Cadena Text en Tokens.
+   * @param[out] Out       Espacio donde se escriben los Tokens.
+   *
+   * @return Regresa la cantidad de Tokens escritos y si quedaron Tokens sin escribir.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline constexpr SplitIntoResult SplitInto(Concepts::StringViewCompatible auto&& Text, const Traits::CharacterTypeOf<decltype(Text)> Delimiter, const std::span<std::basic_string_view<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTraitsOf<decltype(Text)>>> Out) noexcept
+  {
+    return Details::SplitIntoSpan(Split<Options>(std::forward<decltype(Text)>(Text), Delimiter), Out);
+  }
+
+  namespace Details
+  {
+    /**
+     * @brief Cantidad de Tokens de Split<Options>(Text, Pattern), calculada en tiempo de compilación.
+     */
+    template <FixedString Text, FixedString Pattern, StringSplitOptions Options>
+    inline constexpr size_t StaticTokenCount = static_cast<size_t>(std::ranges::distance(Split<Options>(Text.View(), Pattern.View())));
+  } // namespace Details
+
+  /**
+   * @brief Separa una Cadena literal en Tokens en tiempo de compilación.
+   *
+   *  Por ejemplo: constexpr auto keys = Split<"Host,Accept,Content-Type", ",">(); // std::array<std::string_view, 3>
+   *
+   *  La cantidad de Tokens se calcula en tiempo de compilación, por lo que no queda ningún trabajo para el inicio del programa.
+   *  Los Tokens apuntan a los parámetros de plantilla Text, que tienen duración estática.
+   *
+   * @tparam Text    Cadena literal que será separada en Tokens.
+   * @tparam Pattern Cadena literal usada como Patrón para separar la Cadena Text en Tokens.
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @return Regresa un std::array<std::basic_string_view<CharType>, N> con todos los Tokens.
+   */
+  template <FixedString Text, FixedString Pattern, StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] consteval auto Split() noexcept
+  requires std::same_as<typename decltype(Text.View())::value_type, typename decltype(Pattern.View())::value_type>
+  {
+    std::array<decltype(Text.View()), Details::StaticTokenCount<Text, Pattern, Options>> tokens{};
+    std::ranges::copy(Split<Options>(Text.View(), Pattern.View()), tokens.begin());
+    return tokens;
+  }
+
+  /**
+   * @brief Tabla de posiciones de los Tokens de una cadena que permite acceso aleatorio en O(1).
+   *
+   *  Recorre una sola vez un Views::SplitView y guarda el inicio y el fin de cada Token como desplazamientos respecto al
+   *  inicio de la cadena. Los desplazamientos se almacenan en un std::vector<uint32_t>, y solo si la cadena supera los
+   *  4 GiB se usa un std::vector<uint64_t>.
+   *
+   *  Se comporta como un rango std::ranges::random_access_range y std::ranges::sized_range de std::basic_string_view,
+   *  por lo que puede combinarse con Views::ValuesToStringView y std::ranges::to.
+   *
+   *  Por ejemplo: SplitIndex columns{ Split(row, ',') }; columns[17];
+   *
+   * @tparam CharType  Tipo del caracter de la cadena.
+   * @tparam TraitType Tipo del std::char_traits<CharType> de la cadena.
+   */
+  template <typename CharType, typename TraitType = std::char_traits<CharType>>
+  class SplitIndex
+  {
+    public:
+      using string_view_type = std::basic_string_view<CharType, TraitType>;
+      using value_type       = string_view_type;
+      using reference        = string_view_type;
+      using const_reference  = string_view_type;
+      using size_type        = std::size_t;
+      using difference_type  = std::ptrdiff_t;
+
+      class Iterator
+      {
+        public:
+          using iterator_concept  = std::random_access_iterator_tag;
+          using iterator_category = std::input_iterator_tag;
+          using value_type        = string_view_type;
+          using reference         = string_view_type;
+          using difference_type   = std::ptrdiff_t;
+
+          Iterator() = default;
+          Iterator(const SplitIndex& parent, difference_type index) noexcept;
+
+          [[nodiscard]] value_type operator*() const noexcept;
+          [[nodiscard]] value_type operator[](difference_type offset) const noexcept;
+
+          Iterator& operator++() noexcept;
+          Iterator  operator++(int32_t) noexcept;
+          Iterator& operator--() noexcept;
+          Iterator  operator--(int32_t) noexcept;
+          Iterator& operator+=(difference_type offset) noexcept;
+          Iterator& operator-=(difference_type offset) noexcept;
+
+          [[nodiscard]] friend Iterator operator+(Iterator iterator, difference_type offset) noexcept
+          {
+            return iterator += offset;
+          }
+
+          [[nodiscard]] friend Iterator operator+(difference_type offset, Iterator iterator) noexcept
+          {
+            return iterator += offset;
+          }
+
+          [[nodiscard]] friend Iterator operator-(Iterator iterator, difference_type offset) noexcept
+          {
+            return iterator -= offset;
+          }
+
+          [[nodiscard]] friend difference_type operator-(const Iterator& left, const Iterator& right) noexcept
+          {
+            return left.m_Index - right.m_Index;
+          }
+
+          [[nodiscard]] friend bool operator==(const Iterator& left, const Iterator& right) noexcept
+          {
+            return left.m_Index == right.m_Index;
+          }
+
+          [[nodiscard]] friend std::strong_ordering operator<=>(const Iterator& left, const Iterator& right) noexcept
+          {
+            return left.m_Index <=> right.m_Index;
+          }
+
+        private:
+          const SplitIndex* m_Parent{ nullptr };
+          difference_type   m_Index{ 0 };
+      };
+
+      using iterator       = Iterator;
+      using const_iterator = Iterator;
+
+      SplitIndex() = default;
+
+      /**
+       * @brief Recorre una sola vez los Tokens de la vista y guarda su posición.
+       *
+       * @param[in] tokens Vista de Tokens, por ejemplo el resultado de Split(Text, Pattern) o SplitAny(Text, Delimiters).
+       */
+      template <typename Searcher, StringSplitOptions Options>
+      explicit SplitIndex(const Views::SplitView<CharType, TraitType, Searcher, Options>& tokens);
+
+      [[nodiscard]] size_type size() const noexcept;
+      [[nodiscard]] bool      empty() const noexcept;
+
+      [[nodiscard]] string_view_type operator[](size_type index) const noexcept;
+
+      [[nodiscard]] Iterator begin() const noexcept;
+      [[nodiscard]] Iterator end() const noexcept;
+
+      /**
+       * @brief Cadena original sobre la que se calcularon las posiciones de los Tokens.
+       */
+      [[nodiscard]] string_view_type base() const noexcept;
+
+      /**
+       * @brief Indica si las posiciones se almacenan con 64 bits porque la cadena supera los 4 GiB.
+       */
+      [[nodiscard]] bool IsWide() const noexcept;
+
+      /**
+       * @brief Tamaño mínimo de cada bloque de ParallelSplit, por debajo de este valor no compensa crear más hilos.
+       */
+      inline static constexpr size_type MinimumParallelChunkSize = 1 << 20;
+
+      /**
+       * @brief Construye la tabla de Tokens separando la cadena en bloques que se recorren de forma concurrente.
+       *
+       *  1. La cadena se divide en chunk_count bloques y el inicio de cada bloque se ajusta al siguiente delimitador.
+       *  2. Cada bloque se recorre en su propio hilo hasta alcanzar el delimitador inicial del bloque siguiente.
+       *  3. Los bloques se unen en orden. Si un patrón que se solapa consigo mismo (por ejemplo "aa") hace que el delimitador
+       *     inicial de un bloque no coincida con el recorrido secuencial, ese tramo se vuelve a recorrer de forma secuencial.
+       *
+       *  El resultado es idéntico al de SplitIndex{ Split<Options>(text, ...) }.
+       *
+       * @tparam Options  Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+       * @tparam Searcher Buscador con el protocolo de std::default_searcher. No debe producir coincidencias vacías.
+       *
+       * @param[in] text        Cadena que será separada en Tokens.
+       * @param[in] searcher    Buscador que localiza cada delimitador, se comparte entre todos los hilos.
+       * @param[in] chunk_count Cantidad de bloques (e hilos) a usar.
+       */
+      template <StringSplitOptions Options, typename Searcher>
+      [[nodiscard]] static SplitIndex Parallel(string_view_type text, const Searcher& searcher, size_type chunk_count);
+
+    private:
+      template <StringSplitOptions Options, typename Searcher, typename OffsetType>
+      void ParallelScan(const Searcher& searcher, size_type chunk_count, std::vector<OffsetType>& offsets);
+
+      void Append(size_type first, size_type last);
+
+      string_view_type      m_Text{};
+      std::vector<uint32_t> m_NarrowOffsets{};
+      std::vector<uint64_t> m_WideOffsets{};
+      bool                  m_Wide{ false };
+  };
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  SplitIndex(const Views::SplitView<CharType, TraitType, Searcher, Options>&) -> SplitIndex<CharType, TraitType>;
+
+  namespace Details
+  {
+    /**
+     * @brief Cantidad de hilos que representa un ThreadCount, ThreadCount{} equivale a std::thread::hardware_concurrency().
+     */
+    [[nodiscard]] inline size_t ThreadCountOf(const ThreadCount thread_count) noexcept;
+  } // namespace Details
+
+  /**
+   * @brief Separa una Cadena de gran tamaño en Tokens usando varios hilos.
+   *
+   *  Produce el mismo resultado que SplitIndex{ Split<Options>(Text, Pattern) }, pero recorre la cadena en bloques concurrentes
+   *  de al menos SplitIndex::MinimumParallelChunkSize caracteres.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Text         Cadena que será separada en Tokens.
+   * @param[in] Pattern      Cadena usada como Patrón para separar la Cadena Text en Tokens.
+   * @param[in] Threads      Cantidad máxima de hilos a usar, ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+   *
+   * @return Regresa un SplitIndex<CharType, TraitType> con la posición de todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline auto ParallelSplit(Concepts::StringViewCompatible auto&& Text, Concepts::StringViewCompatible auto&& Pattern, const ThreadCount Threads = ThreadCount{})
+  requires std::same_as<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTypeOf<decltype(Pattern)>>
+  {
+    using CharType   = Traits::CharacterTypeOf<decltype(Text)>;
+    using TraitType  = Traits::CharacterTraitsOf<decltype(Text)>;
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Index      = SplitIndex<CharType, TraitType>;
+
+    const StringView text{ Text };
+    const StringView pattern{ Pattern };
+
+    if ( pattern.empty() )
+    {
+      return Index{ Split<Options>(text, pattern) };
+    }
+
+    const size_t chunk_count = std::clamp<size_t>(text.size() / Index::MinimumParallelChunkSize, 1, Details::ThreadCountOf(Threads));
+    return Index::template Parallel<Options>(text, Searchers::PatternSearcher<CharType, TraitType>{ pattern }, chunk_count);
+  }
+
+  /**
+   * @brief Separa una Cadena de gran tamaño en Tokens usando varios hilos y un único caracter como delimitador.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Text         Cadena que será separada en Tokens.
+   * @param[in] Delimiter    Caracter usado como delimitador para separar la Cadena Text en Tokens.
+   * @param[in] Threads      Cantidad máxima de hilos a usar, ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+   *
+   * @return Regresa un SplitIndex<CharType, TraitType> con la posición de todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline auto ParallelSplit(Concepts::StringViewCompatible auto&& Text, const Traits::CharacterTypeOf<decltype(Text)> Delimiter, const ThreadCount Threads = ThreadCount{})
+  {
+    using CharType   = Traits::CharacterTypeOf<decltype(Text)>;
+    using TraitType  = Traits::CharacterTraitsOf<decltype(Text)>;
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Index      = SplitIndex<CharType, TraitType>;
+
+    const StringView text{ Text };
+
+    const size_t chunk_count = std::clamp<size_t>(text.size() / Index::MinimumParallelChunkSize, 1, Details::ThreadCountOf(Threads));
+    return Index::template Parallel<Options>(text, Searchers::CharacterSearcher<CharType, TraitType>{ Delimiter }, chunk_count);
+  }
+
+  /**
+   * @brief Separa en Tokens los caracteres de un flujo de entrada sin cargarlo completo en memoria.
+   *
+   *  Los caracteres se leen en bloques sobre un buffer de tamaño fijo, por lo que permite procesar archivos más grandes que la memoria.
+   *  Cada Token solo es válido hasta el siguiente incremento del iterador, ver Views::StreamSplitView.
+   *
+   *  Por ejemplo: for ( std::string_view line : StreamSplit(std::cin, '\n') ) { ... }
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Stream     Flujo de entrada del que se leen los caracteres, debe existir mientras se recorra la vista.
+   * @param[in] Pattern    Cadena usada como Patrón para separar los caracteres en Tokens.
+   * @param[in] BufferSize Tamaño del buffer en caracteres, debe ser mayor que el Token más largo.
+   *
+   * @return Regresa una vista de un solo recorrido de std::basic_string_view<CharType, TraitType> con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries, typename CharType, typename TraitType>
+  [[nodiscard]] inline auto StreamSplit(std::basic_istream<CharType, TraitType>& Stream, Concepts::StringViewCompatible auto&& Pattern, const size_t BufferSize = DefaultStreamBufferSize)
+  requires std::same_as<CharType, Traits::CharacterTypeOf<decltype(Pattern)>>
+  {
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Reader     = Readers::StreamReader<CharType, TraitType>;
+    using Searcher   = Searchers::PatternSearcher<CharType, TraitType>;
+
+    const StringView pattern{ Pattern };
+    return Views::StreamSplitView<CharType, TraitType, Reader, Searcher, Options>{ Reader{ Stream }, Searcher{ pattern }, std::max<size_t>(pattern.size(), 1) - 1, BufferSize };
+  }
+
+  /**
+   * @brief Separa en Tokens los caracteres de un flujo de entrada usando un único caracter como delimitador.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] Stream     Flujo de entrada del que se leen los caracteres, debe existir mientras se recorra la vista.
+   * @param[in] Delimiter  Caracter usado como delimitador para separar los caracteres en Tokens.
+   * @param[in] BufferSize Tamaño del buffer en caracteres, debe ser mayor que el Token más largo.
+   *
+   * @return Regresa una vista de un solo recorrido de std::basic_string_view<CharType, TraitType> con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries, typename CharType, typename TraitType>
+  [[nodiscard]] inline auto StreamSplit(std::basic_istream<CharType, TraitType>& Stream, const std::type_identity_t<CharType> Delimiter, const size_t BufferSize = DefaultStreamBufferSize)
+  {
+    using Reader   = Readers::StreamReader<CharType, TraitType>;
+    using Searcher = Searchers::CharacterSearcher<CharType, TraitType>;
+
+    return Views::StreamSplitView<CharType, TraitType, Reader, Searcher, Options>{ Reader{ Stream }, Searcher{ Delimiter }, 0, BufferSize };
+  }
+
+  /**
+   * @brief Separa en Tokens los bytes leídos de un descriptor de archivo sin cargarlos completos en memoria.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] FileDescriptor Descriptor de archivo abierto para lectura, no se cierra al terminar.
+   * @param[in] Pattern        Cadena usada como Patrón para separar los bytes en Tokens.
+   * @param[in] BufferSize     Tamaño del buffer en bytes, debe ser mayor que el Token más largo.
+   *
+   * @return Regresa una vista de un solo recorrido de std::string_view con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline auto StreamSplit(const int32_t FileDescriptor, const std::string_view Pattern, const size_t BufferSize = DefaultStreamBufferSize)
+  {
+    using Reader   = Readers::FileDescriptorReader;
+    using Searcher = Searchers::PatternSearcher<char>;
+
+    return Views::StreamSplitView<char, std::char_traits<char>, Reader, Searcher, Options>{ Reader{ FileDescriptor }, Searcher{ Pattern }, std::max<size_t>(Pattern.size(), 1) - 1, BufferSize };
+  }
+
+  /**
+   * @brief Separa en Tokens los bytes leídos de un descriptor de archivo usando un único caracter como delimitador.
+   *
+   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
+   *
+   * @param[in] FileDescriptor Descriptor de archivo abierto para lectura, no se cierra al terminar.
+   * @param[in] Delimiter      Caracter usado como delimitador para separar los bytes en Tokens.
+   * @param[in] BufferSize     Tamaño del buffer en bytes, debe ser mayor que el Token más largo.
+   *
+   * @return Regresa una vista de un solo recorrido de std::string_view con todos los Tokens.
+   */
+  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
+  [[nodiscard]] inline auto StreamSplit(const int32_t FileDescriptor, const char Delimiter, const size_t BufferSize = DefaultStreamBufferSize)
+  {
+    using Reader   = Readers::FileDescriptorReader;
+    using Searcher = Searchers::CharacterSearcher<char>;
+
+    return Views::StreamSplitView<char, std::char_traits<char>, Reader, Searcher, Options>{ Reader{ FileDescriptor }, Searcher{ Delimiter }, 0, BufferSize };
+  }
+
+  /**
+   * @brief Tabla de campos de un texto CSV (RFC 4180) que permite acceso aleatorio a cualquier fila y columna.
+   *
+   *  El texto se recorre en bloques de 64 bytes: para cada bloque se calculan con SSE2 las máscaras de bits de las comillas,
+   *  los delimitadores y los saltos de línea. La región entre comillas se obtiene con el XOR prefijo de la máscara de comillas
+   *  (al estilo de simdcsv), de modo que los delimitadores y saltos de línea dentro de un campo entre comillas se descartan
+   *  sin examinar caracter por caracter. Las comillas escapadas ("") invierten el estado 2 veces y no lo alteran.
+   *
+   *  Los campos no se copian: cada uno es un std::ranges::subrange<const char*> sobre el texto original, sin las comillas
+   *  exteriores y sin el '\r' de los saltos de línea "\r\n". Las comillas escapadas de un campo solo se convierten
+   *  cuando se solicita con UnescapedField o Unescape, que es el único caso que reserva memoria.
+   *
+   *  Por ejemplo:
+   *
+   *    CsvIndex csv{ text };
+   *    for ( std::string_view field : csv.Row(17) ) { ... }
+   */
+  class CsvIndex
+  {
+    public:
+      using field_type = std::ranges::subrange<const char*>;
+      using size_type  = std::size_t;
+
+      CsvIndex() = default;
+
+      /**
+       * @param[in] text      Texto CSV, debe existir mientras se use la tabla.
+       * @param[in] delimiter Caracter que separa los campos.
+       * @param[in] quote     Caracter que delimita los campos entre comillas.
+       */
+      explicit CsvIndex(std::string_view text, char delimiter = ',', char quote = '"');
+
+      [[nodiscard]] size_type RowCount() const noexcept;
+      [[nodiscard]] size_type FieldCount() const noexcept;
+      [[nodiscard]] size_type ColumnCount(size_type row) const noexcept;
+
+      /**
+       * @brief Campo de la fila y columna indicadas, sin las comillas exteriores. Las comillas escapadas ("") se conservan.
+       */
+      [[nodiscard]] std::string_view Field(size_type row, size_type column) const noexcept;
+
+      /**
+       * @brief Indica si el campo estaba entre comillas en el texto original.
+       */
+      [[nodiscard]] bool IsQuoted(size_type row, size_type column) const noexcept;
+
+      /**
+       * @brief Campo de la fila y columna indicadas con las comillas escapadas ("") convertidas en una sola comilla.
+       */
+      [[nodiscard]] std::string UnescapedField(size_type row, size_type column) const;
+
+      /**
+       * @brief Campos de una fila como un rango std::ranges::random_access_range de std::string_view.
+       */
+      [[nodiscard]] auto Row(size_type row) const noexcept
+      {
+        return std::span<const field_type>{ m_Fields.data() + m_RowStarts[row], m_RowStarts[row + 1] - m_RowStarts[row] } | Views::ValuesToStringView;
+      }
+
+      [[nodiscard]] auto operator[](size_type row) const noexcept
+      {
+        return Row(row);
+      }
+
+      /**
+       * @brief Texto original sobre el que se calcularon los campos.
+       */
+      [[nodiscard]] std::string_view base() const noexcept;
+
+      /**
+       * @brief Convierte las comillas escapadas ("") de un campo en una sola comilla.
+       */
+      [[nodiscard]] static std::string Unescape(std::string_view field, char quote = '"');
+
+    private:
+      void Scan();
+      void AppendField(size_type first, size_type last, bool end_of_row);
+
+      std::string_view        m_Text{};
+      char                    m_Delimiter{ ',' };
+      char                    m_Quote{ '"' };
+      std::vector<field_type> m_Fields{};
+      std::vector<size_type>  m_RowStarts{ 0 };
+  };
+
+  /**
+   * @brief Resultado de RangeMismatch.
+   *
+   * @tparam Ordering Tipo del resultado del comparador: std::strong_ordering, std::weak_ordering ó std::partial_ordering.
+   */
+  template <typename Ordering>
+  struct RangeMismatchResult
+  {
+      /**
+       * @brief Cantidad de elementos equivalentes antes de la primera diferencia: la posición del primer par distinto, la
+       *        longitud del rango más corto si uno es prefijo del otro, ó la cantidad de elementos comparados si son equivalentes.
+       */
+      size_t Position;
+
+      /**
+       * @brief Resultado de la comparación, el mismo que regresa RangeCompare con los mismos argumentos.
+       */
+      Ordering Order;
+
+      [[nodiscard]] friend constexpr bool operator==(const RangeMismatchResult&, const RangeMismatchResult&) noexcept = default;
+  };
+
+  namespace Details::FunctionObjects
+  {
+    /**
+     * @brief Proyección que regresa la forma de un caracter sin distinción de mayúsculas y minúsculas (Details::FoldCase).
+     *
+     *  Usada como proyección de RangeCompare, con el comparador por defecto y 2 rangos contiguos del mismo tipo de caracter,
+     *  la comparación se delega en Details::MismatchIgnoreCase en lugar de proyectar cada elemento por separado.
+     */
+    struct CaseInsensitive
+    {
+        template <Concepts::TextCharacter CharType>
+        [[nodiscard]] CharType operator()(const CharType character) const
+        {
+          return Details::FoldCase(character);
+        }
+    };
+  } // namespace Details::FunctionObjects
+
+  namespace Details
+  {
+    /**
+     * @brief Concepto que verifica que un par iterador/sentinela recorra elementos contiguos en memoria.
+     */
+    template <typename First, typename Last>
+    concept ContiguousIterators = std::contiguous_iterator<std::remove_cvref_t<First>> and std::sized_sentinel_for<std::remove_cvref_t<Last>, std::remove_cvref_t<First>>;
+
+    /**
+     * @brief Concepto que verifica que un rango sea de acceso aleatorio y conozca su tamaño, requisito para dividirlo en bloques.
+     */
+    template <typename Range>
+    concept SizedRandomAccessRange = std::ranges::random_access_range<Range> and std::ranges::sized_range<Range>;
+
+    /**
+     * @brief Mueve los elementos de [first, first + order.size()) para que en cada posición quede el elemento order[posición].
+     *        Cada elemento se mueve una sola vez; al terminar order es la permutación identidad.
+     */
+    template <std::random_access_iterator Iterator>
+    void PermuteInPlace(Iterator first, std::vector<size_t>& order);
+
+    /**
+     * @brief Elemento de SortStrings: la clave, su posición original en el rango y sus siguientes caracteres a partir de la profundidad actual.
+     */
+    template <typename CharType>
+    struct StringSortEntry
+    {
+        uint64_t                         Prefix;
+        std::basic_string_view<CharType> Key;
+        size_t                           Index;
+    };
+
+    /**
+     * @brief Los siguientes 8 bytes de la clave a partir de depth empaquetados en un entero, rellenando con 0 después del final.
+     *
+     *  Los caracteres con signo se empaquetan con el bit de signo invertido, por lo que el orden sin signo de 2 prefijos distintos
+     *  es el de RangeCompare con std::strong_ordering sobre esos caracteres.
+     */
+    template <Concepts::TextCharacter CharType>
+    [[nodiscard]] inline uint64_t StringSortPrefix(std::basic_string_view<CharType> key, size_t depth) noexcept;
+
+    /**
+     * @brief Multikey quicksort sobre el prefijo empaquetado de cada clave: se parte en 3 grupos (<, ==, >) por el prefijo y solo
+     *        el grupo igual avanza a los siguientes 8 bytes, por lo que los prefijos comunes no se vuelven a comparar.
+     *
+     * @param[in,out] entries Elementos a ordenar.
+     * @param[in]     depth   Cantidad de caracteres iniciales que ya son iguales en todas las claves de entries.
+     * @param[in]     cached  Indica si el campo Prefix de cada elemento ya corresponde a depth.
+     * @param[in]     budget  Particiones restantes antes de usar std::ranges::sort en la misma profundidad, evita el peor caso de O(n²).
+     */
+    template <Concepts::TextCharacter CharType>
+    void MultikeyQuicksort(std::span<StringSortEntry<CharType>> entries, size_t depth, bool cached, size_t budget);
+
+    /**
+     * @brief Concepto que verifica que un par iterador/sentinela recorra caracteres de texto contiguos en memoria.
+     */
+    template <typename First, typename Last>
+    concept ContiguousTextIterators = ContiguousIterators<First, Last> and Concepts::TextCharacter<std::iter_value_t<std::remove_cvref_t<First>>>;
+
+    /**
+     * @brief Concepto que verifica que RangeCompare pueda buscar el primer elemento distinto comparando bytes
+     *        (Details::MismatchBytes): rangos contiguos del mismo tipo entero (ó std::byte), cuya igualdad es la igualdad de
+     *        su representación, sin proyecciones y con el comparador CompareThreeWayOrderFallback.
+     */
+    template <typename LeftFirst, typename LeftLast, typename RightFirst, typename RightLast, typename LeftProjection, typename RightProjection, typename CompareThreeWay>
+    concept BitwiseComparable =                                                                                                          //
+      ContiguousIterators<LeftFirst, LeftLast> and ContiguousIterators<RightFirst, RightLast> and                                         //
+      std::same_as<std::iter_value_t<std::remove_cvref_t<LeftFirst>>, std::iter_value_t<std::remove_cvref_t<RightFirst>>> and            //
+      (std::integral<std::iter_value_t<std::remove_cvref_t<LeftFirst>>> or std::same_as<std::iter_value_t<std::remove_cvref_t<LeftFirst>>, std::byte>) and //
+      std::same_as<std::remove_cvref_t<LeftProjection>, std::identity> and std::same_as<std::remove_cvref_t<RightProjection>, std::identity> and //
+      std::same_as<std::remove_cvref_t<CompareThreeWay>, Cxx::Details::CustomizationPointObjects::CompareThreeWayOrderFallback>;
+
+    /**
+     * @brief Posición del primer byte distinto de [left, left + size) y [right, right + size), ó size si son iguales.
+     *
+     *  Compara 32 bytes por iteración con AVX2 cuando el procesador lo admite (se detecta en tiempo de ejecución), 16 con SSE2
+     *  en el resto de procesadores x86/x64 y 8 bytes por iteración (SWAR) en los demás casos y en los bloques finales.
+     */
+    [[nodiscard]] size_t MismatchBytes(const void* left, const void* right, size_t size) noexcept;
+
+    /**
+     * @brief Hash de 64 bits de [data, data + size) con el algoritmo wyhash: 48 bytes por iteración con productos de 64 x 64 bits.
+     */
+    [[nodiscard]] uint64_t HashBytes(const void* data, size_t size, uint64_t seed) noexcept;
+
+    /**
+     * @brief HashBytes incremental: los bytes se entregan en partes con Append y Finish regresa el mismo hash que HashBytes
+     *        sobre todos los bytes concatenados.
+     *
+     *  Permite calcular el hash de rangos no contiguos (std::list<char>, std::deque<char>) elemento por elemento, de modo
+     *  que coincida con el de un rango contiguo con los mismos valores.
+     */
+    class HashStream
+    {
+      public:
+        explicit HashStream(uint64_t seed) noexcept;
+
+        void Append(const void* data, size_t size) noexcept;
+
+        [[nodiscard]] uint64_t Finish() const noexcept;
+
+      private:
+        /**
+         * @brief Bytes del último bloque procesado que conserva el buffer, la lectura final de wyhash puede solaparse con ellos.
+         */
+        inline static constexpr size_t HistorySize = 16;
+        inline static constexpr size_t BlockSize   = 48;
+
+        std::array<uint64_t, 3>                            m_Seeds{};
+        std::array<unsigned char, HistorySize + BlockSize> m_Buffer{};
+        uint64_t                                           m_Seed{};
+        size_t                                             m_Pending{ 0 };
+        size_t                                             m_Size{ 0 };
+    };
+
+    /**
+     * @brief Distancia de Levenshtein entre 2 secuencias de bytes con el algoritmo bit-paralelo de Myers.
+     *
+     *  La secuencia más corta se codifica en palabras de 64 bits: con hasta 64 bytes cada byte de la otra secuencia cuesta O(1)
+     *  operaciones, y con más se usa la variante por bloques de Myers/Hyyrö con ⌈m / 64⌉ palabras por byte.
+     *
+     * @return Regresa la distancia, ó maximum_distance + 1 en cuanto se sabe que la distancia es mayor que maximum_distance.
+     */
+    [[nodiscard]] size_t EditDistanceBytes(const unsigned char* left, size_t left_size, const unsigned char* right, size_t right_size, size_t maximum_distance);
+
+    /**
+     * @brief Concepto que verifica que los elementos proyectados de un rango se comparen como bytes en RangeEditDistance.
+     */
+    template <typename Range, typename Projection>
+    concept ByteProjected = (std::integral<std::remove_cvref_t<std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>>> or  //
+                             std::same_as<std::remove_cvref_t<std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>>, std::byte>) and //
+                            sizeof(std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>) == 1;
+
+    /**
+     * @brief Combina el hash acumulado de un rango con el hash de su siguiente elemento, el resultado depende del orden de los elementos.
+     */
+    [[nodiscard]] inline constexpr uint64_t CombineHash(uint64_t state, uint64_t value) noexcept;
+
+    /**
+     * @brief Mezcla final de un hash combinado para que todos los bits del resultado dependan de todos los bits de la entrada.
+     */
+    [[nodiscard]] inline constexpr uint64_t FinalizeHash(uint64_t state) noexcept;
+
+    /**
+     * @brief Concepto que verifica que el hash de un rango dependa de la representación de sus elementos: enteros ó std::byte sin proyección.
+     */
+    template <typename First, typename Projection>
+    concept ByteSequenceHashable =                                                                                                          //
+      (std::integral<std::iter_value_t<std::remove_cvref_t<First>>> or std::same_as<std::iter_value_t<std::remove_cvref_t<First>>, std::byte>) and //
+      std::same_as<std::remove_cvref_t<Projection>, std::identity>;
+
+    /**
+     * @brief Concepto que verifica que un rango se pueda calcular con HashBytes en una sola llamada: ByteSequenceHashable y contiguo.
+     */
+    template <typename First, typename Last, typename Projection>
+    concept BitwiseHashable = ContiguousIterators<First, Last> and ByteSequenceHashable<First, Projection>;
+
+    /**
+     * @brief Concepto que verifica que RangeCompare pueda delegar la comparación en Details::MismatchIgnoreCase: rangos
+     *        contiguos del mismo tipo de caracter, proyección IgnoreCase en ambos y el comparador CompareThreeWayOrderFallback.
+     */
+    template <typename LeftFirst, typename LeftLast, typename RightFirst, typename RightLast, typename LeftProjection, typename RightProjection, typename CompareThreeWay>
+    concept CaseInsensitiveComparable =                                                                                                  //
+      ContiguousTextIterators<LeftFirst, LeftLast> and ContiguousTextIterators<RightFirst, RightLast> and                                 //
+      std::same_as<std::iter_value_t<std::remove_cvref_t<LeftFirst>>, std::iter_value_t<std::remove_cvref_t<RightFirst>>> and            //
+      std::same_as<std::remove_cvref_t<LeftProjection>, FunctionObjects::CaseInsensitive> and                                           //
+      std::same_as<std::remove_cvref_t<RightProjection>, FunctionObjects::CaseInsensitive> and                                          //
+      std::same_as<std::remove_cvref_t<CompareThreeWay>, Cxx::Details::CustomizationPointObjects::CompareThreeWayOrderFallback>;
+
+  } // namespace Details
+
+  namespace Details::FunctionObjects
+  {
+    /**
+     * @brief Objeto función que busca la primera diferencia de 2 Rangos de categoría mínima: std::input_iterator.
+     *
+     *  Recibe los mismos argumentos que RangeCompare y además del resultado de la comparación indica en qué posición divergen los rangos.
+     */
+    class RangeMismatch : public NotQuiteObject
+    {
+      private:
+        /**
+         * @brief Este valor es usado como UINT64_MAX para aquellas sobrecargas que no provean un número determinado de elementos a comparar.
+         */
+        inline static constexpr size_t DefaultSize = static_cast<size_t>(-1);
+
+      public:
+        using NotQuiteObject::NotQuiteObject;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         *  Cada rango debe proveer un "Begin" y "End" según el estandar de C++.
+         *  El tipo del "End" no tiene que coincidir con el tipo del "Begin", "End" puede ser un Sentinela.
+         *
+         *  Para cada rango se debe proveer un método de proyección para transformar los datos antes de ser comparados.
+         *  Y por último se debe proporcionar un método que compare cada valor del rango usando cualquier mecanismo de comparación de 3 vías de C++.
+         *
+         *  Este método de comparación debe regresar unos de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         *  Este método regresa la posición de la primera diferencia y si el Rango 1 es (>, >=, <, <=, ==, !=) que el Rango 2.
+         *
+         * @tparam LeftFirst std::input_iterator del primer elemento del Rango 1.
+         * @tparam LeftLast  std::sentinel_for<LeftFirst> del elemento siguiente al último del Rango 1.
+         * @tparam RightFirst std::input_iterator del primer elemento del Rango 2.
+         * @tparam RightLast  std::sentinel_for<RightFirst> del elemento siguiente al último del Rango 2.
+         * @tparam LeftProjection  std::invocable<std::iter_value_t<LeftFirst>> Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @tparam RightProjection std::invocable<std::iter_value_t<RightFirst>> Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         * @tparam CompareThreeWay std::invocable<projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>> Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] left_first Iterador del primer elemento del Rango 1.
+         * @param[in] left_last  Iterador/Sentinela del elemento siguiente al último del Rango 1.
+         * @param[in] right_first Iterador del primer elemento del Rango 2.
+         * @param[in] right_last  Iterador/Sentinela del elemento siguiente al último del Rango 2.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías, de tipo (std::strong_ordering, std::weak_ordering, std::partial_ordering) según el argumento compare_three_way_order_fallback.
+         */
+        template < // clang-format off
+          std::input_iterator          LeftFirst,
+          std::sentinel_for<LeftFirst> LeftLast,
+          std::input_iterator           RightFirst,
+          std::sentinel_for<RightFirst> RightLast,
+          std::invocable<std::iter_value_t<LeftFirst>>  LeftProjection,
+          std::invocable<std::iter_value_t<RightFirst>> RightProjection,
+          std::invocable<projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>> CompareThreeWay>
+        constexpr auto operator()(
+          LeftFirst&& left_first, LeftLast&& left_last, RightFirst&& right_first, RightLast&& right_last,
+          size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection,
+          CompareThreeWay&& compare_three_way_order_fallback
+        ) const noexcept(noexcept(std::invoke(
+            std::forward<CompareThreeWay>(compare_three_way_order_fallback),
+              std::invoke(std::forward<LeftProjection>(left_projection), *left_first),
+              std::invoke(std::forward<RightProjection>(right_projection), *right_first)
+          ))) -> RangeMismatchResult<std::invoke_result_t<CompareThreeWay, projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>>>;
+        // clang-format on
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam CompareThreeWay Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>, std::ranges::range_value_t<RightRange>> CompareThreeWay>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, CompareThreeWay&& compare_three_way_order_fallback) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam LeftProjection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @tparam RightProjection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, LeftProjection&& left_projection, RightProjection&& right_projection) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam LeftProjection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @tparam RightProjection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         * @tparam CompareThreeWay Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, LeftProjection>, projected_t<std::ranges::iterator_t<RightRange>, RightProjection>> CompareThreeWay>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, LeftProjection&& left_projection, RightProjection&& right_projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam CompareThreeWay Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>, std::ranges::range_value_t<RightRange>> CompareThreeWay>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, CompareThreeWay&& compare_three_way_order_fallback) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam LeftProjection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @tparam RightProjection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam LeftProjection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @tparam RightProjection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         * @tparam CompareThreeWay Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, LeftProjection>, projected_t<std::ranges::iterator_t<RightRange>, RightProjection>> CompareThreeWay>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept;
 
-  /**
-   * @brief Separa una Cadena en una lista de Tokens según el Patrón indicado.
-   *
-   * @tparam Options Opción para indicar si se debe regresar un rango con valores vacíos o sin ellos.
-   *
-   * @param[in] Text    Cadena que será separada en Tokens.
-   * @param[in] Pattern Cadena usada como Patrón para separar la Cadena Text en Tokens.
-   *
-   * @return Regresa una lista de std::basic_string_view<CharType, TraitType> con todos los Tokens.
-   */
-  template <StringSplitOptions Options = StringSplitOptions::RemoveEmptyEntries>
-  [[nodiscard]] inline constexpr auto Split(Concepts::StringViewCompatible auto&& Text, Concepts::StringViewCompatible auto&& Pattern) noexcept
-  requires std::same_as<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTypeOf<decltype(Pattern)>>
-  {
-    using enum StringSplitOptions;
-    using StringView = std::basic_string_view<Traits::CharacterTypeOf<decltype(Text)>, Traits::CharacterTraitsOf<decltype(Text)>>;
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam Projection Método de transformación para cada valor del Rango antes de ser comparado.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] projection  Método de transformación para cada valor del Rango antes de ser comparado.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+        requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, Projection&& projection) const noexcept;
 
-    auto&& tokens = StringView{ Text } | std::views::split(StringView{ Pattern }) | Views::ValuesToStringView;
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam Projection Método de transformación para cada valor del Rango antes de ser comparado.
+         * @tparam CompareThreeWay Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] projection  Método de transformación para cada valor del Rango antes de ser comparado.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, Projection>, projected_t<std::ranges::iterator_t<RightRange>, Projection>> CompareThreeWay>
+        requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, Projection&& projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept;
 
-    if constexpr ( Options == RemoveEmptyEntries )
-    {
-      return tokens | Views::IgnoreEmptyValues;
-    }
-    else
-    {
-      return tokens;
-    }
-  }
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam Projection Método de transformación para cada valor del Rango antes de ser comparado.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         * @param[in] projection Método de transformación para cada valor del Rango antes de ser comparado.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+        requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, Projection&& projection) const noexcept;
+
+        /**
+         * @brief Busca la primera diferencia de 2 rangos de categoría mínima: std::input_iterator.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam Projection Método de transformación para cada valor del Rango antes de ser comparado.
+         * @tparam CompareThreeWay Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] left_range  Rango 1 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] right_range Rango 2 de categoría: std::ranges::input_range que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         * @param[in] projection Método de transformación para cada valor del Rango antes de ser comparado.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa un RangeMismatchResult con la posición de la primera diferencia y el resultado de la comparación de 3 vías.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, Projection>, projected_t<std::ranges::iterator_t<RightRange>, Projection>> CompareThreeWay>
+        requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+        constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, Projection&& projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept;
+    };
 
-  namespace Details::FunctionObjects
-  {
     /**
      * @brief Objeto función que compara 2 Rangos de categoría mínima: std::input_iterator.
      */
@@ -353,9 +2667,26 @@ namespace Cxx::Algorithms::inline V1
          */
         inline static constexpr size_t DefaultSize = static_cast<size_t>(-1);
 
+        /**
+         * @brief Compara los primeros elementos de 2 rangos de acceso aleatorio en bloques de ParallelBlockSize elementos usando varios hilos.
+         *
+         *  Los hilos toman los bloques en orden creciente y ninguno empieza un bloque posterior al primer bloque distinto encontrado,
+         *  por lo que el resultado es el del bloque distinto de menor índice, igual al de la comparación secuencial.
+         */
+        template <typename LeftIterator, typename RightIterator, typename LeftProjection, typename RightProjection, typename CompareThreeWay>
+        auto ParallelCompare(
+          size_t thread_count, LeftIterator left_first, size_t left_size, RightIterator right_first, size_t right_size, size_t number_of_items_to_compare,
+          LeftProjection& left_projection, RightProjection& right_projection, CompareThreeWay& compare_three_way_order_fallback
+        ) const;
+
       public:
         using NotQuiteObject::NotQuiteObject;
 
+        /**
+         * @brief Cantidad de elementos de cada bloque que comparan las sobrecargas concurrentes. Los rangos con un solo bloque se comparan en el hilo actual.
+         */
+        inline static constexpr size_t ParallelBlockSize = 1 << 18;
+
         /**
          * @brief Compara 2 rangos de categoría mínima: std::input_iterator.
          *
@@ -633,6 +2964,260 @@ namespace Cxx::Algorithms::inline V1
         template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, Projection>, projected_t<std::ranges::iterator_t<RightRange>, Projection>> CompareThreeWay>
         requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
         constexpr auto operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, Projection&& projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept;
+
+        /**
+         * @brief Compara 2 rangos de acceso aleatorio de gran tamaño usando varios hilos.
+         *
+         *  Los rangos se dividen en bloques de ParallelBlockSize elementos que se comparan de forma concurrente; el resultado es el
+         *  del primer bloque distinto y los bloques posteriores a este ya no se comparan. Es el mismo resultado que la sobrecarga secuencial.
+         *
+         * @tparam LeftRange  Rango de acceso aleatorio y tamaño conocido.
+         * @tparam RightRange Rango de acceso aleatorio y tamaño conocido.
+         * @tparam LeftProjection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @tparam RightProjection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         * @tparam CompareThreeWay Método de comparación de 3 vías. Debe retornar uno de los siguientes tipos: std::strong_ordering, std::weak_ordering, std::partial_ordering.
+         *
+         * @param[in] thread_count Cantidad de hilos a usar, ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+         * @param[in] left_range  Rango 1 que se va ha comparar.
+         * @param[in] right_range Rango 2 que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado, se invoca desde varios hilos.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado, se invoca desde varios hilos.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías, se invoca desde varios hilos.
+         *
+         * @see Cxx::CompareThreeWayOrderFallback
+         * @return Regresa una valor de tipo (std::strong_ordering, std::weak_ordering, std::partial_ordering). Este valor representa si el Rango 1 es (>, >=, <, <=, ==, !=) que el Rango 2.
+         */
+        template <SizedRandomAccessRange LeftRange, SizedRandomAccessRange RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, LeftProjection>, projected_t<std::ranges::iterator_t<RightRange>, RightProjection>> CompareThreeWay>
+        auto operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection, CompareThreeWay&& compare_three_way_order_fallback) const;
+
+        /**
+         * @brief Compara 2 rangos de acceso aleatorio de gran tamaño usando varios hilos.
+         *
+         * @param[in] thread_count Cantidad de hilos a usar, ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+         * @param[in] left_range  Rango 1 que se va ha comparar.
+         * @param[in] right_range Rango 2 que se va ha comparar.
+         *
+         * @return Regresa una valor de tipo (std::strong_ordering, std::weak_ordering, std::partial_ordering). Este valor representa si el Rango 1 es (>, >=, <, <=, ==, !=) que el Rango 2.
+         */
+        template <SizedRandomAccessRange LeftRange, SizedRandomAccessRange RightRange>
+        auto operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range) const;
+
+        /**
+         * @brief Compara los primeros number_of_items_to_compare elementos de 2 rangos de acceso aleatorio usando varios hilos.
+         *
+         * @param[in] thread_count Cantidad de hilos a usar, ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+         * @param[in] left_range  Rango 1 que se va ha comparar.
+         * @param[in] right_range Rango 2 que se va ha comparar.
+         * @param[in] number_of_items_to_compare Cantidad de elementos a comparar. Usar "-1" si se van a comparar todos los elementos.
+         *
+         * @return Regresa una valor de tipo (std::strong_ordering, std::weak_ordering, std::partial_ordering). Este valor representa si el Rango 1 es (>, >=, <, <=, ==, !=) que el Rango 2.
+         */
+        template <SizedRandomAccessRange LeftRange, SizedRandomAccessRange RightRange>
+        auto operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare) const;
+
+        /**
+         * @brief Compara 2 rangos de acceso aleatorio de gran tamaño usando varios hilos y un método de comparación de 3 vías.
+         *
+         * @param[in] thread_count Cantidad de hilos a usar, ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+         * @param[in] left_range  Rango 1 que se va ha comparar.
+         * @param[in] right_range Rango 2 que se va ha comparar.
+         * @param[in] compare_three_way_order_fallback Método de comparación de 3 vías, se invoca desde varios hilos.
+         *
+         * @return Regresa una valor de tipo (std::strong_ordering, std::weak_ordering, std::partial_ordering). Este valor representa si el Rango 1 es (>, >=, <, <=, ==, !=) que el Rango 2.
+         */
+        template <SizedRandomAccessRange LeftRange, SizedRandomAccessRange RightRange, std::invocable<std::ranges::range_value_t<LeftRange>, std::ranges::range_value_t<RightRange>> CompareThreeWay>
+        auto operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, CompareThreeWay&& compare_three_way_order_fallback) const;
+
+        /**
+         * @brief Compara 2 rangos de acceso aleatorio de gran tamaño usando varios hilos y una proyección para cada rango.
+         *
+         * @param[in] thread_count Cantidad de hilos a usar, ThreadCount{} usa std::thread::hardware_concurrency() hilos.
+         * @param[in] left_range  Rango 1 que se va ha comparar.
+         * @param[in] right_range Rango 2 que se va ha comparar.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado, se invoca desde varios hilos.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado, se invoca desde varios hilos.
+         *
+         * @return Regresa una valor de tipo (std::strong_ordering, std::weak_ordering, std::partial_ordering). Este valor representa si el Rango 1 es (>, >=, <, <=, ==, !=) que el Rango 2.
+         */
+        template <SizedRandomAccessRange LeftRange, SizedRandomAccessRange RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection>
+        auto operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, LeftProjection&& left_projection, RightProjection&& right_projection) const;
+    };
+
+    /**
+     * @brief Objeto función que calcula el hash de un Rango de categoría mínima: std::input_iterator, compañero de RangeCompare.
+     *
+     *  Los rangos de enteros ó std::byte sin proyección se calculan con Details::HashBytes (wyhash) sobre su representación, los
+     *  contiguos en una sola llamada y el resto elemento por elemento con Details::HashStream, por lo que std::string, std::string_view,
+     *  std::vector<char> y std::list<char> con el mismo contenido tienen el mismo hash. El resto de rangos combina el hash de cada
+     *  elemento proyectado: std::hash para los valores y RangeHash para los elementos que también son rangos.
+     */
+    class RangeHash : public NotQuiteObject
+    {
+      private:
+        /**
+         * @brief Este valor es usado como UINT64_MAX para aquellas sobrecargas que no provean un número determinado de elementos.
+         */
+        inline static constexpr size_t DefaultSize = static_cast<size_t>(-1);
+
+        /**
+         * @brief Valor inicial del hash combinado de los rangos que no se calculan con Details::HashBytes.
+         */
+        inline static constexpr uint64_t Seed = 0x2D358DCCAA6C78A5;
+
+        /**
+         * @brief Hash de un elemento proyectado: RangeHash si es un rango y std::hash en otro caso.
+         */
+        template <typename Value>
+        [[nodiscard]] static uint64_t HashElement(const Value& value);
+
+      public:
+        using NotQuiteObject::NotQuiteObject;
+
+        /**
+         * @brief Calcula el hash de un rango de categoría mínima: std::input_iterator.
+         *
+         * @tparam First      std::input_iterator del primer elemento del Rango.
+         * @tparam Last       std::sentinel_for<First> del elemento siguiente al último del Rango.
+         * @tparam Projection std::invocable<std::iter_value_t<First>> Método de transformación para cada valor del Rango antes de calcular su hash.
+         *
+         * @param[in] first Iterador del primer elemento del Rango.
+         * @param[in] last  Sentinela del elemento siguiente al último del Rango.
+         * @param[in] number_of_items_to_hash Cantidad de elementos a usar. Usar "-1" si se van a usar todos los elementos.
+         * @param[in] projection Método de transformación para cada valor del Rango antes de calcular su hash.
+         *
+         * @return Regresa el hash del Rango. Los rangos que RangeCompare considera equivalentes con la misma proyección y del mismo tipo tienen el mismo hash.
+         */
+        template <std::input_iterator First, std::sentinel_for<First> Last, std::invocable<std::iter_value_t<First>> Projection>
+        [[nodiscard]] size_t operator()(First&& first, Last&& last, size_t number_of_items_to_hash, Projection&& projection) const;
+
+        /**
+         * @brief Calcula el hash de un rango de categoría mínima: std::input_iterator.
+         *
+         * @param[in] range Rango de categoría: std::ranges::input_range.
+         */
+        template <std::ranges::input_range Range>
+        [[nodiscard]] size_t operator()(Range&& range) const noexcept;
+
+        /**
+         * @brief Calcula el hash de los primeros elementos de un rango de categoría mínima: std::input_iterator.
+         *
+         * @param[in] range Rango de categoría: std::ranges::input_range.
+         * @param[in] number_of_items_to_hash Cantidad de elementos a usar. Usar "-1" si se van a usar todos los elementos.
+         */
+        template <std::ranges::input_range Range>
+        [[nodiscard]] size_t operator()(Range&& range, const size_t number_of_items_to_hash) const noexcept;
+
+        /**
+         * @brief Calcula el hash de un rango de categoría mínima: std::input_iterator con una proyección, por ejemplo RangeHash(Text, IgnoreCase).
+         *
+         * @param[in] range      Rango de categoría: std::ranges::input_range.
+         * @param[in] projection Método de transformación para cada valor del Rango antes de calcular su hash.
+         */
+        template <std::ranges::input_range Range, std::invocable<std::ranges::range_value_t<Range>> Projection>
+        [[nodiscard]] size_t operator()(Range&& range, Projection&& projection) const noexcept;
+
+        /**
+         * @brief Calcula el hash de los primeros elementos de un rango de categoría mínima: std::input_iterator con una proyección.
+         *
+         * @param[in] range      Rango de categoría: std::ranges::input_range.
+         * @param[in] number_of_items_to_hash Cantidad de elementos a usar. Usar "-1" si se van a usar todos los elementos.
+         * @param[in] projection Método de transformación para cada valor del Rango antes de calcular su hash.
+         */
+        template <std::ranges::input_range Range, std::invocable<std::ranges::range_value_t<Range>> Projection>
+        [[nodiscard]] size_t operator()(Range&& range, const size_t number_of_items_to_hash, Projection&& projection) const noexcept;
+    };
+
+    /**
+     * @brief Objeto función que calcula la distancia de edición (Levenshtein) entre 2 Rangos de categoría mínima: std::input_iterator.
+     *
+     *  La distancia es la cantidad mínima de inserciones, eliminaciones y sustituciones de un elemento para convertir un rango en el otro.
+     *  Los elementos proyectados de 1 byte (char, char8_t, uint8_t, std::byte, por ejemplo con la proyección IgnoreCase) se calculan
+     *  con el algoritmo bit-paralelo de Myers, ver Details::EditDistanceBytes; el resto con la programación dinámica de O(n * m) por filas.
+     *
+     *  Las sobrecargas con maximum_distance terminan en cuanto la distancia supera ese valor, lo que permite descartar rápidamente los
+     *  pares distintos, por ejemplo al eliminar duplicados aproximados.
+     */
+    class RangeEditDistance : public NotQuiteObject
+    {
+      private:
+        /**
+         * @brief Este valor es usado como UINT64_MAX para aquellas sobrecargas que no provean una distancia máxima.
+         */
+        inline static constexpr size_t DefaultMaximumDistance = static_cast<size_t>(-1);
+
+      public:
+        using NotQuiteObject::NotQuiteObject;
+
+        /**
+         * @brief Calcula la distancia de edición entre 2 rangos.
+         *
+         * @tparam LeftRange  Rango de tipo std::ranges::input_range.
+         * @tparam RightRange Rango de tipo std::ranges::input_range.
+         * @tparam LeftProjection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @tparam RightProjection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         *
+         * @param[in] left_range  Rango 1.
+         * @param[in] right_range Rango 2.
+         * @param[in] maximum_distance Distancia máxima de interés. Usar "-1" para calcular siempre la distancia exacta.
+         * @param[in] left_projection  Método de transformación para cada valor del Rango 1 antes de ser comparado.
+         * @param[in] right_projection Método de transformación para cada valor del Rango 2 antes de ser comparado.
+         *
+         * @return Regresa la distancia si es menor ó igual que maximum_distance, y maximum_distance + 1 en otro caso.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_reference_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_reference_t<RightRange>> RightProjection>
+        requires std::equality_comparable_with<std::invoke_result_t<LeftProjection&, std::ranges::range_reference_t<LeftRange>>, std::invoke_result_t<RightProjection&, std::ranges::range_reference_t<RightRange>>>
+        [[nodiscard]] size_t operator()(LeftRange&& left_range, RightRange&& right_range, size_t maximum_distance, LeftProjection&& left_projection, RightProjection&& right_projection) const;
+
+        /**
+         * @brief Calcula la distancia de edición entre 2 rangos.
+         *
+         * @param[in] left_range  Rango 1.
+         * @param[in] right_range Rango 2.
+         *
+         * @return Regresa la distancia de edición.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+        [[nodiscard]] size_t operator()(LeftRange&& left_range, RightRange&& right_range) const;
+
+        /**
+         * @brief Calcula la distancia de edición entre 2 rangos si no es mayor que maximum_distance.
+         *
+         * @param[in] left_range  Rango 1.
+         * @param[in] right_range Rango 2.
+         * @param[in] maximum_distance Distancia máxima de interés.
+         *
+         * @return Regresa la distancia si es menor ó igual que maximum_distance, y maximum_distance + 1 en otro caso.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+        [[nodiscard]] size_t operator()(LeftRange&& left_range, RightRange&& right_range, const size_t maximum_distance) const;
+
+        /**
+         * @brief Calcula la distancia de edición entre 2 rangos con la misma proyección, por ejemplo RangeEditDistance(Left, Right, IgnoreCase).
+         *
+         * @param[in] left_range  Rango 1.
+         * @param[in] right_range Rango 2.
+         * @param[in] projection  Método de transformación para cada valor de los 2 Rangos antes de ser comparado.
+         *
+         * @return Regresa la distancia de edición.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+        requires std::invocable<Projection&, std::ranges::range_reference_t<LeftRange>> and std::invocable<Projection&, std::ranges::range_reference_t<RightRange>>
+        [[nodiscard]] size_t operator()(LeftRange&& left_range, RightRange&& right_range, Projection&& projection) const;
+
+        /**
+         * @brief Calcula la distancia de edición entre 2 rangos con la misma proyección si no es mayor que maximum_distance.
+         *
+         * @param[in] left_range  Rango 1.
+         * @param[in] right_range Rango 2.
+         * @param[in] maximum_distance Distancia máxima de interés.
+         * @param[in] projection  Método de transformación para cada valor de los 2 Rangos antes de ser comparado.
+         *
+         * @return Regresa la distancia si es menor ó igual que maximum_distance, y maximum_distance + 1 en otro caso.
+         */
+        template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+        requires std::invocable<Projection&, std::ranges::range_reference_t<LeftRange>> and std::invocable<Projection&, std::ranges::range_reference_t<RightRange>>
+        [[nodiscard]] size_t operator()(LeftRange&& left_range, RightRange&& right_range, const size_t maximum_distance, Projection&& projection) const;
     };
   } // namespace Details::FunctionObjects
 
@@ -640,8 +3225,96 @@ namespace Cxx::Algorithms::inline V1
    * @brief Objeto función que compara 2 Rangos de categoría mínima: std::input_iterator.
    */
   inline constexpr Details::FunctionObjects::RangeCompare RangeCompare{ NotQuiteObject::ConstructTag{} };
+
+  /**
+   * @brief Objeto función que busca la primera diferencia de 2 Rangos de categoría mínima: std::input_iterator.
+   */
+  inline constexpr Details::FunctionObjects::RangeMismatch RangeMismatch{ NotQuiteObject::ConstructTag{} };
+
+  /**
+   * @brief Objeto función que calcula el hash de un Rango de categoría mínima: std::input_iterator.
+   */
+  inline constexpr Details::FunctionObjects::RangeHash RangeHash{ NotQuiteObject::ConstructTag{} };
+
+  /**
+   * @brief Objeto función que calcula la distancia de edición (Levenshtein) entre 2 Rangos de categoría mínima: std::input_iterator.
+   */
+  inline constexpr Details::FunctionObjects::RangeEditDistance RangeEditDistance{ NotQuiteObject::ConstructTag{} };
+
+  /**
+   * @brief Hasher transparente basado en RangeHash para los contenedores no ordenados.
+   *
+   *  Por ejemplo std::unordered_map<std::string, size_t, RangeHasher, std::equal_to<>> se puede consultar con los std::string_view
+   *  de Split sin crear un std::string por cada búsqueda. Las cadenas (incluidas las literales) se calculan como std::basic_string_view,
+   *  por lo que el '\0' final de un arreglo de caracteres no forma parte del hash.
+   */
+  struct RangeHasher
+  {
+      /**
+       * @brief Habilita la busqueda de claves de diferentes tipos para los contenedores asociativos.
+       */
+      using is_transparent = int32_t;
+
+      template <typename Range>
+      requires Concepts::StringViewCompatible<Range> or std::ranges::input_range<Range>
+      [[nodiscard]] size_t operator()(Range&& range) const noexcept;
+  };
+
+  /**
+   * @brief Ordena un rango por la clave que regresa la proyección Key invocándola una sola vez por elemento (decorate-sort-undecorate).
+   *
+   *  std::ranges::sort(Range, Less, Projection) y RangeCompare con proyecciones invocan la proyección en cada comparación, es decir
+   *  O(n log n) veces. Aquí las claves se calculan una vez en un buffer contiguo, se ordenan los índices según esas claves y
+   *  al final los elementos se permutan en su lugar siguiendo los ciclos de la permutación, por lo que cada elemento se mueve una vez.
+   *
+   *  Las claves que son rangos (por ejemplo std::string) se comparan con RangeCompare y el resto con el comparador de 3 vías.
+   *  El orden es estable: los elementos con claves equivalentes conservan su orden relativo.
+   *
+   * @param[in,out] Items   Rango de acceso aleatorio que será ordenado.
+   * @param[in]     Key     Proyección que calcula la clave de cada elemento, se invoca exactamente una vez por elemento.
+   * @param[in]     Compare Método de comparación de 3 vías para las claves (ó para sus elementos si las claves son rangos).
+   *
+   * @return Regresa la referencia de Items.
+   */
+  template <Details::SizedRandomAccessRange Range, typename Projection, typename CompareThreeWay = const Cxx::Details::CustomizationPointObjects::CompareThreeWayOrderFallback&>
+  requires std::permutable<std::ranges::iterator_t<Range>> and std::invocable<Projection&, std::ranges::range_reference_t<Range>>
+  inline Range& SortByProjection(Range& Items, Projection&& Key, CompareThreeWay&& Compare = CompareThreeWayOrderFallback);
+
+  /**
+   * @brief Ordena un rango de cadenas (ó de elementos con una clave de texto) en el mismo orden que RangeCompare.
+   *
+   *  std::ranges::sort con RangeCompare vuelve a comparar los prefijos comunes de las claves en cada comparación. SortStrings usa
+   *  multikey quicksort sobre los siguientes 8 bytes de cada clave guardados junto a ella, y solo avanza al siguiente bloque de
+   *  8 bytes con las claves cuyo bloque actual es igual, ver Details::MultikeyQuicksort. Al final los elementos se permutan en su lugar.
+   *
+   *  El orden es el de RangeCompare(Left, Right) con std::strong_ordering sobre los caracteres (char con signo donde char tiene signo)
+   *  y una clave es menor que las claves de las que es prefijo. El orden de los elementos con claves iguales no se conserva.
+   *
+   * @param[in,out] Items Rango de acceso aleatorio que será ordenado.
+   * @param[in]     Key   Proyección que regresa la clave de texto de cada elemento (std::string_view, std::string, const char*, ...).
+   *                      Se invoca una vez por elemento; si regresa una cadena por valor, las claves se guardan mientras se ordena.
+   *
+   * @return Regresa la referencia de Items.
+   */
+  template <Details::SizedRandomAccessRange Range, typename Projection = const std::identity&>
+  requires std::permutable<std::ranges::iterator_t<Range>> and std::invocable<Projection&, std::ranges::range_reference_t<Range>> and
+           Concepts::StringViewCompatible<std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>> and
+           Concepts::TextCharacter<Traits::CharacterTypeOf<std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>>>
+  inline Range& SortStrings(Range& Items, Projection&& Key = Identity);
+
+  /**
+   * @brief Proyección para comparar texto sin distinguir mayúsculas y minúsculas, por ejemplo: RangeCompare(Left, Right, IgnoreCase).
+   */
+  inline constexpr Details::FunctionObjects::CaseInsensitive IgnoreCase{};
 } // namespace Cxx::Algorithms::inline V1
 
 #include "Implementations/Algorithms.tcc"
+#include "Implementations/SplitView.tcc"
+#include "Implementations/SplitIndex.tcc"
+#include "Implementations/StreamSplit.tcc"
+#include "Implementations/Utf8.tcc"
+#include "Implementations/JoinWith.tcc"
+#include "Implementations/LetterCase.tcc"
+#include "Implementations/StringSort.tcc"
 
 #endif /* B5A9594F_915C_489B_ACFA_0EC539CC64F8 */
@@ -2,6 +2,7 @@
 #define B3F8C498_3BB4_4FB7_A932_438C43F6CF2B
 
 #include <stdexcept>
+#include <system_error>
 
 namespace Cxx
 {
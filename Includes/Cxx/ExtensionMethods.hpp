@@ -37,39 +37,61 @@ namespace Cxx::LINQ::MethodSyntax
         }
     };
 
+    /**
+     * @brief UpperCase: convierte con Algorithms::ToUpperCase ó Algorithms::ToUpperCaseInPlace, así que los caracteres no ASCII
+     *        siguen la configuración regional global vigente en cada llamada y no la que había cuando se usó por primera vez.
+     */
+    /**
+     * @brief UpperCase: convierte con Algorithms::ToUpperCase, así que los caracteres no ASCII siguen la configuración regional
+     *        global obtenida en la primera conversión del programa. Después de std::locale::global se debe llamar a
+     *        Algorithms::ToUpperCase(Text, Locale) con la configuración nueva.
+     */
     struct UpperCaseImplementation
     {
         template <typename CharType, typename TraitType, typename AllocatorType>
-        constexpr auto&& operator()(const std::basic_string<CharType, TraitType, AllocatorType>& value) const noexcept
+        auto operator()(std::basic_string<CharType, TraitType, AllocatorType>& value) const -> std::basic_string<CharType, TraitType, AllocatorType>&
         {
-          CharType* letter = const_cast<CharType*>(value.data());
-          // TODO: const auto& ctype_facet = std::use_facet<std::ctype_byname<char>>(std::locale());
+          return Algorithms::ToUpperCaseInPlace(value);
+        }
 
-          for ( ; *letter != '\0'; ++letter )
-          {
-            // TODO: *letter = static_cast<CharType>(ctype_facet.toupper(*letter));
-            *letter = std::toupper(*letter, std::locale()); // TODO: Crear el facet para cada tipo de caracter.
-          }
+        template <typename CharType, typename TraitType, typename AllocatorType>
+        auto operator()(std::basic_string<CharType, TraitType, AllocatorType>&& value) const -> std::basic_string<CharType, TraitType, AllocatorType>
+        {
+          return std::move(Algorithms::ToUpperCaseInPlace(value));
+        }
 
-          return value;
+        template <Concepts::StringViewCompatible StringType>
+        auto operator()(StringType&& value) const
+        {
+          return Algorithms::ToUpperCase(std::forward<StringType>(value));
         }
     };
 
+    /**
+     * @brief LowerCase: convierte con Algorithms::ToLowerCase ó Algorithms::ToLowerCaseInPlace, con la misma configuración
+     *        regional que UpperCaseImplementation.
+     */
+    /**
+     * @brief LowerCase: convierte con Algorithms::ToLowerCase, con la misma configuración regional que UpperCaseImplementation.
+     */
     struct LowerCaseImplementation
     {
         template <typename CharType, typename TraitType, typename AllocatorType>
-        constexpr auto&& operator()(const std::basic_string<CharType, TraitType, AllocatorType>& value) const noexcept
+        auto operator()(std::basic_string<CharType, TraitType, AllocatorType>& value) const -> std::basic_string<CharType, TraitType, AllocatorType>&
         {
-          CharType* letter = const_cast<CharType*>(value.data());
-          // TODO: const auto& ctype_facet = std::use_facet<std::ctype_byname<char>>(std::locale());
+          return Algorithms::ToLowerCaseInPlace(value);
+        }
 
-          for ( ; *letter != '\0'; ++letter )
-          {
-            // TODO: *letter = static_cast<CharType>(ctype_facet.tolower(*letter));
-            *letter = std::tolower(*letter, std::locale()); // TODO: Crear el facet para cada tipo de caracter.
-          }
+        template <typename CharType, typename TraitType, typename AllocatorType>
+        auto operator()(std::basic_string<CharType, TraitType, AllocatorType>&& value) const -> std::basic_string<CharType, TraitType, AllocatorType>
+        {
+          return std::move(Algorithms::ToLowerCaseInPlace(value));
+        }
 
-          return value;
+        template <Concepts::StringViewCompatible StringType>
+        auto operator()(StringType&& value) const
+        {
+          return Algorithms::ToLowerCase(std::forward<StringType>(value));
         }
     };
 
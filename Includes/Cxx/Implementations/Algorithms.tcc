@@ -1,21 +1,333 @@
 namespace Cxx::Algorithms::V1
 {
-  template <typename CharType = char, typename TraitType = std::char_traits<CharType>, typename AllocType = std::allocator<CharType>>
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] inline constexpr std::basic_string_view<CharType, TraitType> Details::SeparatorView(const auto& separator) noexcept
+  {
+    if constexpr ( std::same_as<std::remove_cvref_t<decltype(separator)>, CharType> )
+    {
+      return std::basic_string_view<CharType, TraitType>{ std::addressof(separator), 1 };
+    }
+    else
+    {
+      return std::basic_string_view<CharType, TraitType>{ separator };
+    }
+  }
+
+  template <typename CharType, typename TraitType, typename AllocType>
+  void Details::AppendJoinedStrings(std::basic_string<CharType, TraitType, AllocType>& output, std::ranges::input_range auto&& container, std::basic_string_view<CharType, TraitType> separator)
+  {
+    using StringView = std::basic_string_view<CharType, TraitType>;
+    using Reference  = std::ranges::range_reference_t<decltype(container)>;
+
+    // El segundo recorrido se hace dentro de resize_and_overwrite, donde una excepción es comportamiento indefinido y una
+    // longitud distinta a la del primer recorrido escribiría fuera del resultado. Por eso solo se usa con elementos que ya
+    // existen (referencias lvalue ó std::basic_string_view), no con elementos que se construyen al recorrer el rango.
+    if constexpr ( std::ranges::forward_range<decltype(container)> and (std::is_lvalue_reference_v<Reference> or std::ranges::borrowed_range<Reference>) )
+    {
+      // Primer recorrido: longitud exacta del resultado.
+      size_t length = 0;
+      size_t count  = 0;
+
+      for ( auto&& element : container )
+      {
+        length += StringView{ element }.size();
+        ++count;
+      }
+
+      if ( count == 0 )
+      {
+        return;
+      }
+
+      length += separator.size() * (count - 1);
+
+      // Segundo recorrido: copia después del contenido previo, sin inicializar antes la memoria agregada.
+      const size_t previous_size = output.size();
+
+      output.resize_and_overwrite(previous_size + length, [&](CharType* data, size_t)
+      {
+        CharType* position = data + previous_size;
+        bool      first    = true;
+
+        for ( auto&& element : container )
+        {
+          if ( not std::exchange(first, false) )
+          {
+            TraitType::copy(position, separator.data(), separator.size());
+            position += separator.size();
+          }
+
+          const StringView piece{ element };
+          TraitType::copy(position, piece.data(), piece.size());
+          position += piece.size();
+        }
+
+        return previous_size + length;
+      });
+    }
+    else
+    {
+      // Un input_range solo se puede recorrer una vez y los elementos temporales se construyen en cada recorrido: el resultado
+      // crece con append, reservando antes la longitud exacta cuando el rango se puede recorrer 2 veces.
+      if constexpr ( std::ranges::forward_range<decltype(container)> )
+      {
+        size_t length = 0;
+        size_t count  = 0;
+
+        for ( auto&& element : container )
+        {
+          length += StringView{ element }.size();
+          ++count;
+        }
+
+        if ( count == 0 )
+        {
+          return;
+        }
+
+        output.reserve(output.size() + length + separator.size() * (count - 1));
+      }
+
+      bool first = true;
+
+      for ( auto&& element : container )
+      {
+        if ( not std::exchange(first, false) )
+        {
+          output.append(separator);
+        }
+
+        output.append(StringView{ element });
+      }
+    }
+  }
+
+  template <std::integral Integer>
+  [[nodiscard]] inline constexpr size_t Details::DecimalLength(const Integer value) noexcept
+  {
+    using Unsigned = std::make_unsigned_t<Integer>;
+
+    size_t   length    = 1;
+    Unsigned magnitude = static_cast<Unsigned>(value);
+
+    if constexpr ( std::signed_integral<Integer> )
+    {
+      if ( value < 0 )
+      {
+        magnitude = static_cast<Unsigned>(Unsigned{ 0 } - magnitude);
+        ++length;
+      }
+    }
+
+    if constexpr ( sizeof(Unsigned) <= sizeof(uint64_t) )
+    {
+      // Sin saltos: log10(2) ~ 1233 / 4096 estima la cantidad de dígitos a partir de los bits, y una potencia de 10 la corrige.
+      // Los saltos de un ciclo de comparaciones se predicen mal cuando las longitudes de los números son variadas.
+      constexpr std::array<uint64_t, 20> powers_of_10{
+        1ull,          10ull,          100ull,          1000ull,          10000ull,          100000ull,          1000000ull,
+        10000000ull,   100000000ull,   1000000000ull,   10000000000ull,   100000000000ull,   1000000000000ull,   10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+      };
+
+      const auto   wide     = static_cast<uint64_t>(magnitude) | 1; // El 0 tiene 1 dígito, igual que el 1.
+      const size_t estimate = (static_cast<size_t>(std::bit_width(wide)) * 1233) >> 12;
+
+      return length + estimate - static_cast<size_t>(wide < powers_of_10[estimate]);
+    }
+    else
+    {
+      while ( magnitude >= 10 )
+      {
+        magnitude = static_cast<Unsigned>(magnitude / 10);
+        ++length;
+      }
+
+      return length;
+    }
+  }
+
+  template <typename CharType, typename TraitType, typename AllocType>
+  void Details::AppendJoinedNumbers(std::basic_string<CharType, TraitType, AllocType>& output, std::ranges::input_range auto&& container, std::basic_string_view<CharType, TraitType> separator)
+  {
+    using ValueType = std::ranges::range_value_t<decltype(container)>;
+
+    // Suficiente para cualquier entero de 128 bits y para la representación más corta de cualquier long double.
+    std::array<char, 128> digits;
+
+    const auto append_number = [&](const ValueType value)
+    {
+      char* const last = std::to_chars(digits.data(), digits.data() + digits.size(), value).ptr;
+
+      if constexpr ( std::same_as<CharType, char> )
+      {
+        output.append(digits.data(), static_cast<size_t>(last - digits.data()));
+      }
+      else
+      {
+        // Los dígitos, el signo, el punto y el exponente son ASCII: se convierten directamente a CharType.
+        std::ranges::transform(digits.data(), last, std::back_inserter(output), [](const char digit) { return static_cast<CharType>(digit); });
+      }
+    };
+
+    // Igual que en AppendJoinedStrings, el recorrido dentro de resize_and_overwrite solo se hace sobre elementos que ya existen.
+    if constexpr ( std::integral<ValueType> and std::same_as<CharType, char> and std::ranges::forward_range<decltype(container)> and
+                   std::is_lvalue_reference_v<std::ranges::range_reference_t<decltype(container)>> )
+    {
+      // Primer recorrido: longitud exacta del resultado a partir de la cantidad de dígitos.
+      size_t length = 0;
+      size_t count  = 0;
+
+      for ( const ValueType value : container )
+      {
+        length += DecimalLength(value);
+        ++count;
+      }
+
+      if ( count == 0 )
+      {
+        return;
+      }
+
+      length += separator.size() * (count - 1);
+
+      // Segundo recorrido: std::to_chars escribe directamente en output.
+      const size_t previous_size = output.size();
+
+      output.resize_and_overwrite(previous_size + length, [&](char* data, size_t)
+      {
+        char* const last     = data + previous_size + length;
+        char*       position = data + previous_size;
+        bool        first    = true;
+
+        for ( const ValueType value : container )
+        {
+          if ( not std::exchange(first, false) )
+          {
+            TraitType::copy(position, separator.data(), separator.size());
+            position += separator.size();
+          }
+
+          position = std::to_chars(position, last, value).ptr;
+        }
+
+        return previous_size + length;
+      });
+    }
+    else
+    {
+      bool first = true;
+
+      for ( const ValueType value : container )
+      {
+        if ( not std::exchange(first, false) )
+        {
+          output.append(separator);
+        }
+
+        append_number(value);
+      }
+    }
+  }
+
+  template <typename CharType, typename TraitType, typename OutputIterator>
+  OutputIterator Details::WriteJoinedStrings(OutputIterator output, std::ranges::input_range auto&& container, std::basic_string_view<CharType, TraitType> separator)
+  {
+    using StringView = std::basic_string_view<CharType, TraitType>;
+
+    bool first = true;
+
+    for ( auto&& element : container )
+    {
+      const StringView piece{ element };
+
+      if constexpr ( StringViewOutputIterator<OutputIterator, CharType, TraitType> )
+      {
+        if ( not std::exchange(first, false) )
+        {
+          *output++ = separator;
+        }
+
+        *output++ = piece;
+      }
+      else
+      {
+        if ( not std::exchange(first, false) )
+        {
+          output = std::ranges::copy(separator, std::move(output)).out;
+        }
+
+        output = std::ranges::copy(piece, std::move(output)).out;
+      }
+    }
+
+    return output;
+  }
+
+  template <typename CharType, typename TraitType, typename AllocType>
   std::basic_string<CharType, TraitType, AllocType> Join(std::ranges::input_range auto&& container, auto&& separator)
   {
     using ContainerType = decltype(container);
     using SeparatorType = decltype(separator);
 
-    std::basic_ostringstream<CharType, TraitType, AllocType> output;
+    if constexpr ( Details::StringJoinable<ContainerType, SeparatorType, CharType, TraitType> )
+    {
+      std::basic_string<CharType, TraitType, AllocType> result;
+      Details::AppendJoinedStrings(result, container, Details::SeparatorView<CharType, TraitType>(separator));
+      return result;
+    }
+    else if constexpr ( Details::NumberJoinable<ContainerType, SeparatorType, CharType, TraitType> )
+    {
+      std::basic_string<CharType, TraitType, AllocType> result;
+      Details::AppendJoinedNumbers(result, container, Details::SeparatorView<CharType, TraitType>(separator));
+      return result;
+    }
+    else
+    {
+      std::basic_ostringstream<CharType, TraitType, AllocType> output;
+      std::ranges::copy(container, Cxx::DesignPatterns::MakeOstreamJoiner(output, std::forward<SeparatorType>(separator)));
+      return output.str();
+    }
+  };
 
-    std::ranges::copy( //
-      std::ranges::begin(std::forward<ContainerType>(container)),
-      std::ranges::end(std::forward<ContainerType>(container)),
-      Cxx::DesignPatterns::MakeOstreamJoiner(output, std::forward<SeparatorType>(separator))
-    );
+  template <typename CharType, typename TraitType, typename AllocType>
+  std::basic_string<CharType, TraitType, AllocType>& JoinInto(std::basic_string<CharType, TraitType, AllocType>& output, std::ranges::input_range auto&& container, auto&& separator)
+  {
+    using ContainerType = decltype(container);
+    using SeparatorType = decltype(separator);
 
-    return output.str();
-  };
+    if constexpr ( Details::StringJoinable<ContainerType, SeparatorType, CharType, TraitType> )
+    {
+      Details::AppendJoinedStrings(output, container, Details::SeparatorView<CharType, TraitType>(separator));
+    }
+    else if constexpr ( Details::NumberJoinable<ContainerType, SeparatorType, CharType, TraitType> )
+    {
+      Details::AppendJoinedNumbers(output, container, Details::SeparatorView<CharType, TraitType>(separator));
+    }
+    else
+    {
+      output.append(Join<CharType, TraitType, AllocType>(std::forward<ContainerType>(container), std::forward<SeparatorType>(separator)));
+    }
+
+    return output;
+  }
+
+  template <typename CharType, typename TraitType, typename OutputIterator>
+  requires std::output_iterator<OutputIterator, CharType> or Details::StringViewOutputIterator<OutputIterator, CharType, TraitType>
+  OutputIterator JoinInto(OutputIterator output, std::ranges::input_range auto&& container, auto&& separator)
+  {
+    using ContainerType = decltype(container);
+    using SeparatorType = decltype(separator);
+
+    if constexpr ( Details::StringJoinable<ContainerType, SeparatorType, CharType, TraitType> )
+    {
+      return Details::WriteJoinedStrings<CharType, TraitType>(std::move(output), container, Details::SeparatorView<CharType, TraitType>(separator));
+    }
+    else
+    {
+      const std::basic_string<CharType, TraitType> joined = Join<CharType, TraitType>(std::forward<ContainerType>(container), std::forward<SeparatorType>(separator));
+      return Details::WriteJoinedStrings<CharType, TraitType>(std::move(output), std::ranges::single_view{ std::basic_string_view<CharType, TraitType>{ joined } }, {});
+    }
+  }
 
   template < // clang-format off
     std::input_iterator          LeftFirst,
@@ -25,7 +337,7 @@ namespace Cxx::Algorithms::V1
     std::invocable<std::iter_value_t<LeftFirst>>  LeftProjection,
     std::invocable<std::iter_value_t<RightFirst>> RightProjection,
     std::invocable<projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>> CompareThreeWay>
-  constexpr auto Details::FunctionObjects::RangeCompare::operator()(
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(
     LeftFirst&& left_first, LeftLast&& left_last, RightFirst&& right_first, RightLast&& right_last,
     size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection,
     CompareThreeWay&& compare_three_way_order_fallback
@@ -34,19 +346,63 @@ namespace Cxx::Algorithms::V1
            std::invoke(std::forward<LeftProjection>(left_projection), *left_first),
            std::invoke(std::forward<RightProjection>(right_projection), *right_first)
     ))) // clang-format on
-    -> std::invoke_result_t<CompareThreeWay, projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>>
+    -> RangeMismatchResult<std::invoke_result_t<CompareThreeWay, projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>>>
   {
     using compare_three_way_t = std::invoke_result_t<CompareThreeWay, projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>>;
 
+    constexpr bool is_bitwise_comparable         = Details::BitwiseComparable<LeftFirst, LeftLast, RightFirst, RightLast, LeftProjection, RightProjection, CompareThreeWay>;
+    constexpr bool is_case_insensitive_comparable = Details::CaseInsensitiveComparable<LeftFirst, LeftLast, RightFirst, RightLast, LeftProjection, RightProjection, CompareThreeWay>;
+
+    if constexpr ( is_bitwise_comparable or is_case_insensitive_comparable )
+    {
+      if !consteval
+      {
+        using value_type = std::iter_value_t<std::remove_cvref_t<LeftFirst>>;
+
+        const value_type* left       = std::to_address(left_first);
+        const value_type* right      = std::to_address(right_first);
+        const auto        left_size  = static_cast<size_t>(left_last - left_first);
+        const auto        right_size = static_cast<size_t>(right_last - right_first);
+        const size_t      size       = std::min({ left_size, right_size, number_of_items_to_compare });
+
+        size_t mismatch = size;
+
+        if constexpr ( is_bitwise_comparable )
+        {
+          // La posición del primer byte distinto se lleva al elemento que lo contiene, y solo ese par se compara con el comparador,
+          // por lo que el orden es el del tipo (por ejemplo char con signo) y no el de memcmp.
+          mismatch = Details::MismatchBytes(left, right, size * sizeof(value_type)) / sizeof(value_type);
+        }
+        else
+        {
+          mismatch = Details::MismatchIgnoreCase(left, right, size);
+        }
+
+        if ( mismatch < size )
+        {
+          return { mismatch, std::invoke(
+            std::forward<CompareThreeWay>(compare_three_way_order_fallback),
+              std::invoke(std::forward<LeftProjection>(left_projection), left[mismatch]),
+              std::invoke(std::forward<RightProjection>(right_projection), right[mismatch])
+          ) };
+        }
+
+        // Si se compararon number_of_items_to_compare elementos los rangos son equivalentes, en otro caso el más corto es menor.
+        return { size, size == number_of_items_to_compare ? compare_three_way_t::equivalent : compare_three_way_t{ left_size <=> right_size } };
+      }
+    }
+
+    size_t position = 0;
+
     // clang-format off
-    for ( ; number_of_items_to_compare; --number_of_items_to_compare, left_first = std::ranges::next(left_first), right_first = std::ranges::next(right_first) )
+    for ( ; number_of_items_to_compare; --number_of_items_to_compare, ++position, left_first = std::ranges::next(left_first), right_first = std::ranges::next(right_first) )
     {
       if ( left_first == left_last ) {
-        return right_first == right_last ? compare_three_way_t::equivalent : compare_three_way_t::less;
+        return { position, right_first == right_last ? compare_three_way_t::equivalent : compare_three_way_t::less };
       }
 
       if ( right_first == right_last ) {
-        return compare_three_way_t::greater;
+        return { position, compare_three_way_t::greater };
       }
 
       const auto compare_result = std::invoke(
@@ -56,12 +412,117 @@ namespace Cxx::Algorithms::V1
       );
 
       if ( std::is_neq(compare_result) ) {
-        return compare_result;
+        return { position, compare_result };
       }
     }
     // clang-format on
 
-    return compare_three_way_t::equivalent;
+    return { position, compare_three_way_t::equivalent };
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), number_of_items_to_compare, CompareThreeWayOrderFallback);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>, std::ranges::range_value_t<RightRange>> CompareThreeWay>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, CompareThreeWay&& compare_three_way_order_fallback) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), number_of_items_to_compare, Identity, Identity, std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, LeftProjection>, projected_t<std::ranges::iterator_t<RightRange>, RightProjection>> CompareThreeWay>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept
+  {
+    // Los rangos se recorren como lvalue: un temporal (por ejemplo std::string) vive hasta el final de la comparación.
+    return this->operator()(std::ranges::begin(left_range), std::ranges::end(left_range), std::ranges::begin(right_range), std::ranges::end(right_range), number_of_items_to_compare, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection), std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>, std::ranges::range_value_t<RightRange>> CompareThreeWay>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, CompareThreeWay&& compare_three_way_order_fallback) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, Identity, Identity, std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, LeftProjection&& left_projection, RightProjection&& right_projection) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection), CompareThreeWayOrderFallback);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, LeftProjection>, projected_t<std::ranges::iterator_t<RightRange>, RightProjection>> CompareThreeWay>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, LeftProjection&& left_projection, RightProjection&& right_projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection), std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), number_of_items_to_compare, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection), CompareThreeWayOrderFallback);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+  requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, Projection&& projection) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, std::forward<Projection>(projection), std::forward<Projection>(projection), CompareThreeWayOrderFallback);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, Projection>, projected_t<std::ranges::iterator_t<RightRange>, Projection>> CompareThreeWay>
+  requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, Projection&& projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, std::forward<Projection>(projection), std::forward<Projection>(projection), std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+  requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, Projection&& projection) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), number_of_items_to_compare, std::forward<Projection>(projection), std::forward<Projection>(projection), CompareThreeWayOrderFallback);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, Projection>, projected_t<std::ranges::iterator_t<RightRange>, Projection>> CompareThreeWay>
+  requires std::invocable<Projection, std::ranges::range_value_t<LeftRange>> and std::invocable<Projection, std::ranges::range_value_t<RightRange>>
+  constexpr auto Details::FunctionObjects::RangeMismatch::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, Projection&& projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), number_of_items_to_compare, std::forward<Projection>(projection), std::forward<Projection>(projection), std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+  }
+
+  template < // clang-format off
+    std::input_iterator          LeftFirst,
+    std::sentinel_for<LeftFirst> LeftLast,
+    std::input_iterator           RightFirst,
+    std::sentinel_for<RightFirst> RightLast,
+    std::invocable<std::iter_value_t<LeftFirst>>  LeftProjection,
+    std::invocable<std::iter_value_t<RightFirst>> RightProjection,
+    std::invocable<projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>> CompareThreeWay>
+  constexpr auto Details::FunctionObjects::RangeCompare::operator()(
+    LeftFirst&& left_first, LeftLast&& left_last, RightFirst&& right_first, RightLast&& right_last,
+    size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection,
+    CompareThreeWay&& compare_three_way_order_fallback
+  ) const noexcept(noexcept(std::invoke(
+      std::forward<CompareThreeWay>(compare_three_way_order_fallback),
+           std::invoke(std::forward<LeftProjection>(left_projection), *left_first),
+           std::invoke(std::forward<RightProjection>(right_projection), *right_first)
+    ))) // clang-format on
+    -> std::invoke_result_t<CompareThreeWay, projected_t<LeftFirst, LeftProjection>, projected_t<RightFirst, RightProjection>>
+  {
+    // clang-format off
+    return Cxx::Algorithms::RangeMismatch(
+      std::forward<LeftFirst>(left_first), std::forward<LeftLast>(left_last), std::forward<RightFirst>(right_first), std::forward<RightLast>(right_last),
+      number_of_items_to_compare, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection),
+      std::forward<CompareThreeWay>(compare_three_way_order_fallback)
+    ).Order;
+    // clang-format on
   }
 
   template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
@@ -85,7 +546,8 @@ namespace Cxx::Algorithms::V1
   template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, LeftProjection>, projected_t<std::ranges::iterator_t<RightRange>, RightProjection>> CompareThreeWay>
   constexpr auto Details::FunctionObjects::RangeCompare::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection, CompareThreeWay&& compare_three_way_order_fallback) const noexcept
   {
-    return this->operator()(std::ranges::begin(std::forward<LeftRange>(left_range)), std::ranges::end(std::forward<LeftRange>(left_range)), std::ranges::begin(std::forward<RightRange>(right_range)), std::ranges::end(std::forward<RightRange>(right_range)), number_of_items_to_compare, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection), std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+    // Los rangos se recorren como lvalue: un temporal (por ejemplo std::string) vive hasta el final de la comparación.
+    return this->operator()(std::ranges::begin(left_range), std::ranges::end(left_range), std::ranges::begin(right_range), std::ranges::end(right_range), number_of_items_to_compare, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection), std::forward<CompareThreeWay>(compare_three_way_order_fallback));
   }
 
   template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_value_t<LeftRange>, std::ranges::range_value_t<RightRange>> CompareThreeWay>
@@ -139,4 +601,415 @@ namespace Cxx::Algorithms::V1
   {
     return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), number_of_items_to_compare, std::forward<Projection>(projection), std::forward<Projection>(projection), std::forward<CompareThreeWay>(compare_three_way_order_fallback));
   }
+
+  [[nodiscard]] inline size_t Details::ThreadCountOf(const ThreadCount thread_count) noexcept
+  {
+    const auto count = std::to_underlying(thread_count);
+    return count != 0 ? count : std::max<size_t>(std::thread::hardware_concurrency(), 1);
+  }
+
+  template <typename LeftIterator, typename RightIterator, typename LeftProjection, typename RightProjection, typename CompareThreeWay>
+  auto Details::FunctionObjects::RangeCompare::ParallelCompare(
+    const size_t thread_count, const LeftIterator left_first, const size_t left_size, const RightIterator right_first, const size_t right_size, const size_t number_of_items_to_compare,
+    LeftProjection& left_projection, RightProjection& right_projection, CompareThreeWay& compare_three_way_order_fallback
+  ) const
+  {
+    const auto left_at  = [&](const size_t index) { return left_first + static_cast<std::iter_difference_t<LeftIterator>>(index); };
+    const auto right_at = [&](const size_t index) { return right_first + static_cast<std::iter_difference_t<RightIterator>>(index); };
+
+    const auto compare = [&](const size_t first, const size_t left_last, const size_t right_last, const size_t count)
+    {
+      return this->operator()(left_at(first), left_at(left_last), right_at(first), right_at(right_last), count, left_projection, right_projection, compare_three_way_order_fallback);
+    };
+
+    using compare_three_way_t = decltype(compare(0, 0, 0, 0));
+
+    const size_t size         = std::min({ left_size, right_size, number_of_items_to_compare });
+    const size_t block_count  = (size + ParallelBlockSize - 1) / ParallelBlockSize;
+    const size_t worker_count = std::min(thread_count, block_count);
+
+    if ( worker_count <= 1 )
+    {
+      return compare(0, left_size, right_size, number_of_items_to_compare);
+    }
+
+    std::atomic<size_t>                             next_block{ 0 };
+    std::atomic<size_t>                             first_difference{ block_count };
+    std::vector<std::optional<compare_three_way_t>> results(block_count);
+    std::vector<std::exception_ptr>                 errors(worker_count);
+
+    {
+      std::vector<std::jthread> workers;
+      workers.reserve(worker_count);
+
+      for ( size_t index = 0; index < worker_count; ++index )
+      {
+        workers.emplace_back(
+          [&, index]
+          {
+            try
+            {
+              // Un bloque solo se omite si ya existe un bloque distinto de menor índice, por lo que todos los bloques anteriores
+              // al primer bloque distinto se comparan por completo.
+              for ( size_t block = next_block++; block < first_difference.load(std::memory_order_relaxed); block = next_block++ )
+              {
+                const size_t first = block * ParallelBlockSize;
+                const size_t last  = std::min(first + ParallelBlockSize, size);
+
+                const compare_three_way_t result = compare(first, last, last, last - first);
+
+                if ( std::is_neq(result) )
+                {
+                  results[block] = result;
+
+                  for ( size_t current = first_difference.load(); block < current and not first_difference.compare_exchange_weak(current, block); )
+                  {
+                  }
+                }
+              }
+            }
+            catch ( ... )
+            {
+              errors[index] = std::current_exception();
+              first_difference.store(0);
+            }
+          }
+        );
+      }
+    }
+
+    for ( const std::exception_ptr& error : errors )
+    {
+      if ( error )
+      {
+        std::rethrow_exception(error);
+      }
+    }
+
+    if ( const size_t block = first_difference.load(); block != block_count )
+    {
+      return *results[block];
+    }
+
+    return size == number_of_items_to_compare ? compare_three_way_t::equivalent : compare_three_way_t{ left_size <=> right_size };
+  }
+
+  template <Details::SizedRandomAccessRange LeftRange, Details::SizedRandomAccessRange RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection, std::invocable<projected_t<std::ranges::iterator_t<LeftRange>, LeftProjection>, projected_t<std::ranges::iterator_t<RightRange>, RightProjection>> CompareThreeWay>
+  auto Details::FunctionObjects::RangeCompare::operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare, LeftProjection&& left_projection, RightProjection&& right_projection, CompareThreeWay&& compare_three_way_order_fallback) const
+  {
+    return ParallelCompare(
+      Details::ThreadCountOf(thread_count), std::ranges::begin(left_range), static_cast<size_t>(std::ranges::size(left_range)), std::ranges::begin(right_range), static_cast<size_t>(std::ranges::size(right_range)),
+      number_of_items_to_compare, left_projection, right_projection, compare_three_way_order_fallback
+    );
+  }
+
+  template <Details::SizedRandomAccessRange LeftRange, Details::SizedRandomAccessRange RightRange>
+  auto Details::FunctionObjects::RangeCompare::operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range) const
+  {
+    return this->operator()(thread_count, std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, Identity, Identity, CompareThreeWayOrderFallback);
+  }
+
+  template <Details::SizedRandomAccessRange LeftRange, Details::SizedRandomAccessRange RightRange>
+  auto Details::FunctionObjects::RangeCompare::operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, const size_t number_of_items_to_compare) const
+  {
+    return this->operator()(thread_count, std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), number_of_items_to_compare, Identity, Identity, CompareThreeWayOrderFallback);
+  }
+
+  template <Details::SizedRandomAccessRange LeftRange, Details::SizedRandomAccessRange RightRange, std::invocable<std::ranges::range_value_t<LeftRange>, std::ranges::range_value_t<RightRange>> CompareThreeWay>
+  auto Details::FunctionObjects::RangeCompare::operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, CompareThreeWay&& compare_three_way_order_fallback) const
+  {
+    return this->operator()(thread_count, std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, Identity, Identity, std::forward<CompareThreeWay>(compare_three_way_order_fallback));
+  }
+
+  template <Details::SizedRandomAccessRange LeftRange, Details::SizedRandomAccessRange RightRange, std::invocable<std::ranges::range_value_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_value_t<RightRange>> RightProjection>
+  auto Details::FunctionObjects::RangeCompare::operator()(const ThreadCount thread_count, LeftRange&& left_range, RightRange&& right_range, LeftProjection&& left_projection, RightProjection&& right_projection) const
+  {
+    return this->operator()(thread_count, std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultSize, std::forward<LeftProjection>(left_projection), std::forward<RightProjection>(right_projection), CompareThreeWayOrderFallback);
+  }
+
+  template <std::random_access_iterator Iterator>
+  void Details::PermuteInPlace(const Iterator first, std::vector<size_t>& order)
+  {
+    const auto at = [first](const size_t index) { return first + static_cast<std::iter_difference_t<Iterator>>(index); };
+
+    // Cada ciclo de la permutación se recorre una vez moviendo cada elemento directamente a su posición final, y las posiciones
+    // ya colocadas se marcan con order[i] = i.
+    for ( size_t start = 0; start < order.size(); ++start )
+    {
+      if ( order[start] == start )
+      {
+        continue;
+      }
+
+      std::iter_value_t<Iterator> value    = std::ranges::iter_move(at(start));
+      size_t                      position = start;
+
+      for ( size_t next = order[position]; next != start; next = order[position] )
+      {
+        *at(position)   = std::ranges::iter_move(at(next));
+        order[position] = position;
+        position        = next;
+      }
+
+      *at(position)   = std::move(value);
+      order[position] = position;
+    }
+  }
+
+  template <Details::SizedRandomAccessRange Range, typename Projection, typename CompareThreeWay>
+  requires std::permutable<std::ranges::iterator_t<Range>> and std::invocable<Projection&, std::ranges::range_reference_t<Range>>
+  inline Range& SortByProjection(Range& Items, Projection&& Key, CompareThreeWay&& Compare)
+  {
+    using key_t = std::remove_cvref_t<std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>>;
+
+    const auto first = std::ranges::begin(Items);
+    const auto size  = static_cast<size_t>(std::ranges::size(Items));
+    const auto at    = [first](const size_t index) { return first + static_cast<std::ranges::range_difference_t<Range>>(index); };
+
+    // (1) Decorate: una invocación de la proyección por elemento.
+    std::vector<key_t> keys;
+    keys.reserve(size);
+
+    for ( size_t index = 0; index < size; ++index )
+    {
+      keys.push_back(std::invoke(Key, *at(index)));
+    }
+
+    // (2) Sort: se ordenan los índices, las claves no se mueven.
+    std::vector<size_t> order(size);
+    std::iota(order.begin(), order.end(), size_t{ 0 });
+
+    std::ranges::stable_sort(
+      order,
+      [&](const size_t left, const size_t right)
+      {
+        if constexpr ( std::ranges::input_range<const key_t&> )
+        {
+          return std::is_lt(RangeCompare(keys[left], keys[right], Compare));
+        }
+        else
+        {
+          return std::is_lt(std::invoke(Compare, keys[left], keys[right]));
+        }
+      }
+    );
+
+    // (3) Undecorate: cada elemento se mueve una sola vez a su posición final.
+    Details::PermuteInPlace(first, order);
+
+    return Items;
+  }
+
+  [[nodiscard]] inline constexpr uint64_t Details::CombineHash(const uint64_t state, const uint64_t value) noexcept
+  {
+    return std::rotl(state ^ value, 27) * 0x9E3779B97F4A7C15 + 0x52DCE729;
+  }
+
+  [[nodiscard]] inline constexpr uint64_t Details::FinalizeHash(uint64_t state) noexcept
+  {
+    // Mezcla final de MurmurHash3 (fmix64).
+    state ^= state >> 33;
+    state *= 0xFF51AFD7ED558CCD;
+    state ^= state >> 33;
+    state *= 0xC4CEB9FE1A85EC53;
+    state ^= state >> 33;
+    return state;
+  }
+
+  template <typename Value>
+  [[nodiscard]] uint64_t Details::FunctionObjects::RangeHash::HashElement(const Value& value)
+  {
+    if constexpr ( std::ranges::input_range<const Value&> )
+    {
+      return Cxx::Algorithms::RangeHash(value);
+    }
+    else
+    {
+      return std::hash<Value>{}(value);
+    }
+  }
+
+  template <std::input_iterator First, std::sentinel_for<First> Last, std::invocable<std::iter_value_t<First>> Projection>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeHash::operator()(First&& first, Last&& last, size_t number_of_items_to_hash, Projection&& projection) const
+  {
+    if constexpr ( Details::BitwiseHashable<First, Last, Projection> )
+    {
+      using value_type = std::iter_value_t<std::remove_cvref_t<First>>;
+
+      const size_t size = std::min(static_cast<size_t>(last - first), number_of_items_to_hash);
+      return static_cast<size_t>(Details::HashBytes(std::to_address(first), size * sizeof(value_type), 0));
+    }
+    else if constexpr ( Details::ByteSequenceHashable<First, Projection> )
+    {
+      // Mismos bytes que en el caso contiguo, entregados uno por uno para que el hash dependa solo de los valores.
+      Details::HashStream stream{ 0 };
+
+      for ( ; number_of_items_to_hash and first != last; --number_of_items_to_hash, first = std::ranges::next(first) )
+      {
+        const std::iter_value_t<std::remove_cvref_t<First>> value = *first;
+        stream.Append(std::addressof(value), sizeof(value));
+      }
+
+      return static_cast<size_t>(stream.Finish());
+    }
+    else
+    {
+      uint64_t state = Seed;
+      uint64_t count = 0;
+
+      for ( ; number_of_items_to_hash and first != last; --number_of_items_to_hash, ++count, first = std::ranges::next(first) )
+      {
+        state = Details::CombineHash(state, HashElement(std::invoke(projection, *first)));
+      }
+
+      // La cantidad de elementos distingue por ejemplo { "ab", "" } de { "", "ab" } cuando los elementos son rangos.
+      return static_cast<size_t>(Details::FinalizeHash(state ^ count));
+    }
+  }
+
+  template <std::ranges::input_range Range>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeHash::operator()(Range&& range) const noexcept
+  {
+    return this->operator()(std::forward<Range>(range), DefaultSize, Identity);
+  }
+
+  template <std::ranges::input_range Range>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeHash::operator()(Range&& range, const size_t number_of_items_to_hash) const noexcept
+  {
+    return this->operator()(std::forward<Range>(range), number_of_items_to_hash, Identity);
+  }
+
+  template <std::ranges::input_range Range, std::invocable<std::ranges::range_value_t<Range>> Projection>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeHash::operator()(Range&& range, Projection&& projection) const noexcept
+  {
+    return this->operator()(std::forward<Range>(range), DefaultSize, std::forward<Projection>(projection));
+  }
+
+  template <std::ranges::input_range Range, std::invocable<std::ranges::range_value_t<Range>> Projection>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeHash::operator()(Range&& range, const size_t number_of_items_to_hash, Projection&& projection) const noexcept
+  {
+    // Igual que en RangeCompare, el rango se recorre como lvalue para que un temporal viva hasta el final del cálculo.
+    return this->operator()(std::ranges::begin(range), std::ranges::end(range), number_of_items_to_hash, std::forward<Projection>(projection));
+  }
+
+  template <typename Range>
+  requires Concepts::StringViewCompatible<Range> or std::ranges::input_range<Range>
+  [[nodiscard]] size_t RangeHasher::operator()(Range&& range) const noexcept
+  {
+    if constexpr ( Concepts::StringViewCompatible<Range> )
+    {
+      return RangeHash(std::basic_string_view<Traits::CharacterTypeOf<Range>, Traits::CharacterTraitsOf<Range>>{ range });
+    }
+    else
+    {
+      return RangeHash(std::forward<Range>(range));
+    }
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, std::invocable<std::ranges::range_reference_t<LeftRange>> LeftProjection, std::invocable<std::ranges::range_reference_t<RightRange>> RightProjection>
+  requires std::equality_comparable_with<std::invoke_result_t<LeftProjection&, std::ranges::range_reference_t<LeftRange>>, std::invoke_result_t<RightProjection&, std::ranges::range_reference_t<RightRange>>>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeEditDistance::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t maximum_distance, LeftProjection&& left_projection, RightProjection&& right_projection) const
+  {
+    if constexpr ( Details::ByteProjected<LeftRange, LeftProjection> and Details::ByteProjected<RightRange, RightProjection> )
+    {
+      // Los rangos contiguos sin proyección se usan directamente, el resto se proyecta una vez en un buffer de bytes.
+      const auto as_bytes = []<typename Range, typename Projection>(Range& range, Projection& projection, std::vector<unsigned char>& buffer) -> std::span<const unsigned char>
+      {
+        if constexpr ( std::ranges::contiguous_range<Range> and std::ranges::sized_range<Range> and std::same_as<std::remove_cvref_t<Projection>, std::identity> )
+        {
+          return { reinterpret_cast<const unsigned char*>(std::ranges::data(range)), static_cast<size_t>(std::ranges::size(range)) };
+        }
+        else
+        {
+          for ( auto&& element : range )
+          {
+            buffer.push_back(static_cast<unsigned char>(std::invoke(projection, std::forward<decltype(element)>(element))));
+          }
+
+          return buffer;
+        }
+      };
+
+      std::vector<unsigned char> left_buffer;
+      std::vector<unsigned char> right_buffer;
+
+      const std::span<const unsigned char> left  = as_bytes(left_range, left_projection, left_buffer);
+      const std::span<const unsigned char> right = as_bytes(right_range, right_projection, right_buffer);
+
+      return Details::EditDistanceBytes(left.data(), left.size(), right.data(), right.size(), maximum_distance);
+    }
+    else
+    {
+      std::vector<std::remove_cvref_t<std::invoke_result_t<LeftProjection&, std::ranges::range_reference_t<LeftRange>>>>   left;
+      std::vector<std::remove_cvref_t<std::invoke_result_t<RightProjection&, std::ranges::range_reference_t<RightRange>>>> right;
+
+      for ( auto&& element : left_range )
+      {
+        left.push_back(std::invoke(left_projection, std::forward<decltype(element)>(element)));
+      }
+
+      for ( auto&& element : right_range )
+      {
+        right.push_back(std::invoke(right_projection, std::forward<decltype(element)>(element)));
+      }
+
+      if ( std::max(left.size(), right.size()) - std::min(left.size(), right.size()) > maximum_distance )
+      {
+        return maximum_distance + 1;
+      }
+
+      // Programación dinámica por filas: row[column] es la distancia entre left[0, line) y right[0, column).
+      std::vector<size_t> row(right.size() + 1);
+      std::iota(row.begin(), row.end(), size_t{ 0 });
+
+      for ( size_t line = 1; line <= left.size(); ++line )
+      {
+        size_t diagonal = std::exchange(row[0], line);
+        size_t minimum  = line;
+
+        for ( size_t column = 1; column <= right.size(); ++column )
+        {
+          const size_t above = row[column];
+
+          row[column] = std::min({ above + 1, row[column - 1] + 1, diagonal + (left[line - 1] == right[column - 1] ? 0 : 1) });
+          diagonal    = above;
+          minimum     = std::min(minimum, row[column]);
+        }
+
+        // Todo camino de edición cruza cada fila y sus valores nunca decrecen, por lo que el mínimo de la fila es una cota inferior.
+        if ( minimum > maximum_distance )
+        {
+          return maximum_distance + 1;
+        }
+      }
+
+      return row.back() > maximum_distance ? maximum_distance + 1 : row.back();
+    }
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeEditDistance::operator()(LeftRange&& left_range, RightRange&& right_range) const
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultMaximumDistance, Identity, Identity);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeEditDistance::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t maximum_distance) const
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), maximum_distance, Identity, Identity);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+  requires std::invocable<Projection&, std::ranges::range_reference_t<LeftRange>> and std::invocable<Projection&, std::ranges::range_reference_t<RightRange>>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeEditDistance::operator()(LeftRange&& left_range, RightRange&& right_range, Projection&& projection) const
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), DefaultMaximumDistance, projection, projection);
+  }
+
+  template <std::ranges::input_range LeftRange, std::ranges::input_range RightRange, typename Projection>
+  requires std::invocable<Projection&, std::ranges::range_reference_t<LeftRange>> and std::invocable<Projection&, std::ranges::range_reference_t<RightRange>>
+  [[nodiscard]] size_t Details::FunctionObjects::RangeEditDistance::operator()(LeftRange&& left_range, RightRange&& right_range, const size_t maximum_distance, Projection&& projection) const
+  {
+    return this->operator()(std::forward<LeftRange>(left_range), std::forward<RightRange>(right_range), maximum_distance, projection, projection);
+  }
 } // namespace Cxx::Algorithms::V1
@@ -0,0 +1,174 @@
+namespace Cxx::Algorithms::Views
+{
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  constexpr JoinWithView<View, CharType, TraitType>::JoinWithView(View base, std::basic_string<CharType, TraitType> separator)
+    : m_Base{ std::move(base) }
+    , m_Separator{ std::move(separator) }
+  {
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  [[nodiscard]] constexpr typename JoinWithView<View, CharType, TraitType>::Iterator JoinWithView<View, CharType, TraitType>::begin()
+  {
+    return Iterator{ *this, std::ranges::begin(m_Base) };
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  [[nodiscard]] constexpr View JoinWithView<View, CharType, TraitType>::base() const& requires std::copy_constructible<View>
+  {
+    return m_Base;
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  constexpr JoinWithView<View, CharType, TraitType>::Iterator::Iterator(JoinWithView& parent, std::ranges::iterator_t<View> current)
+    : m_Parent{ std::addressof(parent) }
+    , m_Current{ std::move(current) }
+  {
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  [[nodiscard]] constexpr typename JoinWithView<View, CharType, TraitType>::Iterator::value_type JoinWithView<View, CharType, TraitType>::Iterator::operator*() const
+  {
+    if ( m_OnSeparator )
+    {
+      return value_type{ m_Parent->m_Separator.data(), m_Parent->m_Separator.size() };
+    }
+
+    const std::basic_string_view<CharType, TraitType> element{ *m_Current };
+    return value_type{ element.data(), element.size() };
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  constexpr typename JoinWithView<View, CharType, TraitType>::Iterator& JoinWithView<View, CharType, TraitType>::Iterator::operator++()
+  {
+    // Después de un separador sigue el elemento actual; después de un elemento sigue un separador solo si hay otro elemento.
+    if ( m_OnSeparator )
+    {
+      m_OnSeparator = false;
+    }
+    else
+    {
+      ++m_Current;
+      m_OnSeparator = m_Current != std::ranges::end(m_Parent->m_Base);
+    }
+
+    return *this;
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  constexpr typename JoinWithView<View, CharType, TraitType>::Iterator JoinWithView<View, CharType, TraitType>::Iterator::operator++(int32_t)
+  {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  [[nodiscard]] constexpr bool JoinWithView<View, CharType, TraitType>::Iterator::operator==(const Iterator& right) const requires std::equality_comparable<std::ranges::iterator_t<View>>
+  {
+    return m_Current == right.m_Current and m_OnSeparator == right.m_OnSeparator;
+  }
+
+  template <std::ranges::input_range View, typename CharType, typename TraitType>
+  requires std::ranges::view<View> and Concepts::BorrowedStringView<std::ranges::range_reference_t<View>, CharType, TraitType>
+  [[nodiscard]] constexpr bool JoinWithView<View, CharType, TraitType>::Iterator::operator==(std::default_sentinel_t) const
+  {
+    return not m_OnSeparator and m_Current == std::ranges::end(m_Parent->m_Base);
+  }
+} // namespace Cxx::Algorithms::Views
+
+namespace Cxx::Algorithms::V1
+{
+  template <std::ranges::input_range Range>
+  requires std::convertible_to<std::ranges::range_reference_t<Range>, std::span<const char>>
+  size_t WriteChunks(const int32_t FileDescriptor, Range&& Chunks)
+  {
+    std::array<std::span<const char>, WriteChunksBatchSize> batch;
+    std::array<char, WriteChunksBufferSize>                  buffer;
+
+    size_t count   = 0;
+    size_t used    = 0;
+    size_t written = 0;
+
+    using reference = std::ranges::range_reference_t<Range>;
+
+    // Los fragmentos grandes de un rango de entrada ó temporales dejan de ser válidos al avanzar, por lo que no se difieren.
+    constexpr bool stable_chunks = std::ranges::forward_range<Range> and (std::is_lvalue_reference_v<reference> or std::ranges::borrowed_range<reference>);
+
+    // Indica si el último fragmento del lote apunta al buffer, en cuyo caso los siguientes fragmentos pequeños lo extienden.
+    bool buffered = false;
+
+    const auto flush = [&]
+    {
+      if ( count > 0 )
+      {
+        Details::WriteChunks(FileDescriptor, std::span{ batch.data(), count });
+      }
+
+      count    = 0;
+      used     = 0;
+      buffered = false;
+    };
+
+    for ( auto&& chunk : Chunks )
+    {
+      const std::span<const char> bytes{ chunk };
+
+      // Los fragmentos vacíos no se entregan al sistema.
+      if ( bytes.empty() )
+      {
+        continue;
+      }
+
+      written += bytes.size();
+
+      if ( bytes.size() < WriteChunksCopyThreshold )
+      {
+        if ( used + bytes.size() > buffer.size() or (not buffered and count == batch.size()) )
+        {
+          flush();
+        }
+
+        char* const destination = std::ranges::copy(bytes, buffer.data() + used).out - bytes.size();
+        used += bytes.size();
+
+        if ( buffered )
+        {
+          batch[count - 1] = std::span<const char>{ batch[count - 1].data(), batch[count - 1].size() + bytes.size() };
+        }
+        else
+        {
+          batch[count++] = std::span<const char>{ destination, bytes.size() };
+          buffered       = true;
+        }
+
+        continue;
+      }
+
+      if ( count == batch.size() )
+      {
+        flush();
+      }
+
+      batch[count++] = bytes;
+      buffered       = false;
+
+      if constexpr ( not stable_chunks )
+      {
+        flush();
+      }
+    }
+
+    flush();
+
+    return written;
+  }
+} // namespace Cxx::Algorithms::V1
@@ -0,0 +1,107 @@
+namespace Cxx::Algorithms::V1
+{
+  template <Concepts::TextCharacter CharType>
+  inline constexpr void Details::ConvertAsciiCase(const CharType* input, CharType* output, const size_t size, const LetterCase letter_case) noexcept
+  {
+    // Las letras del rango [first, first + 26) cambian de caso con el bit 0x20, sin bifurcaciones.
+    const uint32_t first = letter_case == LetterCase::Upper ? 'a' : 'A';
+
+    for ( size_t index = 0; index < size; ++index )
+    {
+      const auto unit = static_cast<uint32_t>(input[index]);
+      output[index]   = static_cast<CharType>(unit ^ (static_cast<uint32_t>(unit - first < 26) << 5));
+    }
+  }
+
+  template <Concepts::TextCharacter CharType>
+  inline constexpr void Details::ConvertCase(const CharType* input, CharType* output, const size_t size, const LetterCase letter_case) noexcept
+  {
+    ConvertAsciiCase(input, output, size, letter_case);
+  }
+
+  template <Concepts::TextCharacter CharType>
+  [[nodiscard]] inline constexpr CharType Details::FoldCase(const CharType character) noexcept
+  {
+    const auto unit = static_cast<uint32_t>(character);
+    return static_cast<CharType>(unit | (static_cast<uint32_t>(unit - 'A' < 26) << 5));
+  }
+
+  template <Concepts::TextCharacter CharType>
+  [[nodiscard]] inline constexpr size_t Details::MismatchIgnoreCase(const CharType* left, const CharType* right, const size_t size)
+  {
+    for ( size_t index = 0; index < size; ++index )
+    {
+      if ( left[index] != right[index] and FoldCase(left[index]) != FoldCase(right[index]) )
+      {
+        return index;
+      }
+    }
+
+    return size;
+  }
+
+  template <Concepts::TextCharacter CharType>
+  [[nodiscard]] inline constexpr const CharType* Details::SearchIgnoreCase(const CharType* first, const CharType* last, const CharType* pattern, const size_t pattern_size)
+  {
+    if ( pattern_size == 0 )
+    {
+      return first;
+    }
+
+    if ( static_cast<size_t>(last - first) < pattern_size )
+    {
+      return last;
+    }
+
+    const CharType  head  = FoldCase(pattern[0]);
+    const CharType* final = last - pattern_size + 1;
+
+    for ( ; first != final; ++first )
+    {
+      if ( FoldCase(*first) == head and MismatchIgnoreCase(first, pattern, pattern_size) == pattern_size )
+      {
+        return first;
+      }
+    }
+
+    return last;
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] inline std::basic_string<CharType, TraitType> Details::ConvertedCase(const std::basic_string_view<CharType, TraitType> text, const LetterCase letter_case)
+  {
+    std::basic_string<CharType, TraitType> result;
+
+    result.resize_and_overwrite(text.size(), [&](CharType* buffer, size_t)
+    {
+      ConvertCase(text.data(), buffer, text.size(), letter_case);
+      return text.size();
+    });
+
+    return result;
+  }
+
+  template <Concepts::LocaleCharacter CharType, typename TraitType>
+  [[nodiscard]] inline std::basic_string<CharType, TraitType> Details::ConvertedCase(const std::basic_string_view<CharType, TraitType> text, const LetterCase letter_case, const std::locale& locale)
+  {
+    std::basic_string<CharType, TraitType> result;
+
+    result.resize_and_overwrite(text.size(), [&](CharType* buffer, size_t)
+    {
+      ConvertCase(text.data(), buffer, text.size(), letter_case, locale);
+      return text.size();
+    });
+
+    return result;
+  }
+} // namespace Cxx::Algorithms::V1
+
+namespace Cxx::Algorithms::Searchers
+{
+  template <Concepts::TextCharacter CharType, typename TraitType>
+  [[nodiscard]] std::pair<const CharType*, const CharType*> CaseInsensitiveSearcher<CharType, TraitType>::operator()(const CharType* first, const CharType* last) const
+  {
+    const CharType* match = Details::SearchIgnoreCase(first, last, Pattern.data(), Pattern.size());
+    return { match, match == last ? last : match + Pattern.size() };
+  }
+} // namespace Cxx::Algorithms::Searchers
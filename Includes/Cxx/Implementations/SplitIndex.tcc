@@ -0,0 +1,349 @@
+namespace Cxx::Algorithms::V1
+{
+  template <typename CharType, typename TraitType>
+  template <typename Searcher, StringSplitOptions Options>
+  SplitIndex<CharType, TraitType>::SplitIndex(const Views::SplitView<CharType, TraitType, Searcher, Options>& tokens)
+    : m_Text{ tokens.base() }
+    , m_Wide{ tokens.base().size() > std::numeric_limits<uint32_t>::max() }
+  {
+    const CharType* const first = m_Text.data();
+
+    for ( const string_view_type token : tokens )
+    {
+      const auto token_first = static_cast<size_type>(token.data() - first);
+      Append(token_first, token_first + token.size());
+    }
+
+    m_NarrowOffsets.shrink_to_fit();
+    m_WideOffsets.shrink_to_fit();
+  }
+
+  template <typename CharType, typename TraitType>
+  template <StringSplitOptions Options, typename Searcher>
+  [[nodiscard]] SplitIndex<CharType, TraitType> SplitIndex<CharType, TraitType>::Parallel(string_view_type text, const Searcher& searcher, size_type chunk_count)
+  {
+    SplitIndex index;
+    index.m_Text = text;
+    index.m_Wide = text.size() > std::numeric_limits<uint32_t>::max();
+
+    if ( text.empty() )
+    {
+      return index;
+    }
+
+    chunk_count = std::clamp<size_type>(chunk_count, 1, text.size());
+
+    if ( index.m_Wide )
+    {
+      index.template ParallelScan<Options>(searcher, chunk_count, index.m_WideOffsets);
+    }
+    else
+    {
+      index.template ParallelScan<Options>(searcher, chunk_count, index.m_NarrowOffsets);
+    }
+
+    return index;
+  }
+
+  template <typename CharType, typename TraitType>
+  template <StringSplitOptions Options, typename Searcher, typename OffsetType>
+  void SplitIndex<CharType, TraitType>::ParallelScan(const Searcher& searcher, size_type chunk_count, std::vector<OffsetType>& offsets)
+  {
+    using match_type = std::pair<const CharType*, const CharType*>;
+
+    struct Chunk
+    {
+        std::vector<OffsetType> Offsets;
+        const CharType*         Resume{ nullptr };
+        bool                    Consistent{ false };
+    };
+
+    const CharType* const first = m_Text.data();
+    const CharType* const last  = first + m_Text.size();
+
+    const auto search = [&](const CharType* position) -> match_type
+    {
+      const auto [match_first, match_last] = std::invoke(searcher, position, last);
+      return { match_first, match_last };
+    };
+
+    const auto emit = [first](std::vector<OffsetType>& output, const CharType* token_first, const CharType* token_last)
+    {
+      const auto token = Details::ApplyTokenOptions<Options>(string_view_type{ token_first, static_cast<size_type>(token_last - token_first) });
+
+      if ( not HasOption(Options, StringSplitOptions::RemoveEmptyEntries) or not token.empty() )
+      {
+        output.push_back(static_cast<OffsetType>(token.data() - first));
+        output.push_back(static_cast<OffsetType>(token.data() + token.size() - first));
+      }
+    };
+
+    const auto run_concurrently = [](const size_type count, auto&& task)
+    {
+      std::vector<std::exception_ptr> errors(count);
+
+      {
+        std::vector<std::jthread> workers;
+        workers.reserve(count);
+
+        for ( size_type index = 0; index < count; ++index )
+        {
+          workers.emplace_back(
+            [&, index]
+            {
+              try
+              {
+                task(index);
+              }
+              catch ( ... )
+              {
+                errors[index] = std::current_exception();
+              }
+            }
+          );
+        }
+      }
+
+      for ( const std::exception_ptr& error : errors )
+      {
+        if ( error )
+        {
+          std::rethrow_exception(error);
+        }
+      }
+    };
+
+    // (1) Delimitador inicial de cada bloque: la primera coincidencia a partir de la posición nominal del bloque.
+    //     snaps[0] marca el inicio de la cadena y snaps[chunk_count] representa "sin coincidencia" (fin de la cadena).
+    std::vector<match_type> snaps(chunk_count + 1, match_type{ last, last });
+    snaps[0] = { first, first };
+
+    run_concurrently(chunk_count - 1, [&](const size_type index) { snaps[index + 1] = search(first + m_Text.size() / chunk_count * (index + 1)); });
+
+    // (2) Cada bloque se recorre desde el final de su delimitador inicial hasta el delimitador inicial del bloque siguiente.
+    std::vector<Chunk> chunks(chunk_count);
+
+    run_concurrently(
+      chunk_count,
+      [&](const size_type index)
+      {
+        Chunk&            chunk    = chunks[index];
+        const match_type& limit    = snaps[index + 1];
+        const CharType*   position = snaps[index].second;
+
+        if ( index != 0 and snaps[index] == limit )
+        {
+          chunk.Consistent = true;
+          return;
+        }
+
+        for ( ;; )
+        {
+          const match_type match = search(position);
+
+          if ( match.first == last and limit.first == last )
+          {
+            emit(chunk.Offsets, position, last);
+            chunk.Consistent = true;
+            return;
+          }
+
+          if ( match.first < limit.first )
+          {
+            emit(chunk.Offsets, position, match.first);
+            position = match.second;
+            continue;
+          }
+
+          if ( match == limit )
+          {
+            emit(chunk.Offsets, position, match.first);
+            chunk.Consistent = true;
+            return;
+          }
+
+          // Una coincidencia anterior se solapó con el delimitador inicial del bloque siguiente.
+          chunk.Resume = position;
+          return;
+        }
+      }
+    );
+
+    // (3) Unión ordenada de los bloques, corrigiendo de forma secuencial los tramos que no coinciden.
+    size_type total = 0;
+
+    for ( const Chunk& chunk : chunks )
+    {
+      total += chunk.Offsets.size();
+    }
+
+    offsets.reserve(total);
+
+    for ( size_type index = 0; index < chunk_count; )
+    {
+      offsets.insert(offsets.end(), chunks[index].Offsets.begin(), chunks[index].Offsets.end());
+      std::vector<OffsetType>{}.swap(chunks[index].Offsets);
+
+      if ( chunks[index].Consistent )
+      {
+        ++index;
+        continue;
+      }
+
+      const CharType* position = chunks[index].Resume;
+      size_type       next     = index + 1;
+
+      for ( ;; )
+      {
+        const match_type match = search(position);
+
+        if ( match.first == last )
+        {
+          emit(offsets, position, last);
+          index = chunk_count;
+          break;
+        }
+
+        while ( next < chunk_count and snaps[next].first < match.first )
+        {
+          ++next;
+        }
+
+        emit(offsets, position, match.first);
+
+        if ( next < chunk_count and match == snaps[next] )
+        {
+          index = next;
+          break;
+        }
+
+        position = match.second;
+      }
+    }
+
+    offsets.shrink_to_fit();
+  }
+
+  template <typename CharType, typename TraitType>
+  void SplitIndex<CharType, TraitType>::Append(size_type first, size_type last)
+  {
+    if ( m_Wide )
+    {
+      m_WideOffsets.push_back(static_cast<uint64_t>(first));
+      m_WideOffsets.push_back(static_cast<uint64_t>(last));
+    }
+    else
+    {
+      m_NarrowOffsets.push_back(static_cast<uint32_t>(first));
+      m_NarrowOffsets.push_back(static_cast<uint32_t>(last));
+    }
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] typename SplitIndex<CharType, TraitType>::size_type SplitIndex<CharType, TraitType>::size() const noexcept
+  {
+    return (m_Wide ? m_WideOffsets.size() : m_NarrowOffsets.size()) / 2;
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] bool SplitIndex<CharType, TraitType>::empty() const noexcept
+  {
+    return size() == 0;
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] typename SplitIndex<CharType, TraitType>::string_view_type SplitIndex<CharType, TraitType>::operator[](size_type index) const noexcept
+  {
+    const size_type first = m_Wide ? static_cast<size_type>(m_WideOffsets[index * 2]) : m_NarrowOffsets[index * 2];
+    const size_type last  = m_Wide ? static_cast<size_type>(m_WideOffsets[index * 2 + 1]) : m_NarrowOffsets[index * 2 + 1];
+
+    return m_Text.substr(first, last - first);
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] typename SplitIndex<CharType, TraitType>::Iterator SplitIndex<CharType, TraitType>::begin() const noexcept
+  {
+    return Iterator{ *this, 0 };
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] typename SplitIndex<CharType, TraitType>::Iterator SplitIndex<CharType, TraitType>::end() const noexcept
+  {
+    return Iterator{ *this, static_cast<difference_type>(size()) };
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] typename SplitIndex<CharType, TraitType>::string_view_type SplitIndex<CharType, TraitType>::base() const noexcept
+  {
+    return m_Text;
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] bool SplitIndex<CharType, TraitType>::IsWide() const noexcept
+  {
+    return m_Wide;
+  }
+
+  template <typename CharType, typename TraitType>
+  SplitIndex<CharType, TraitType>::Iterator::Iterator(const SplitIndex& parent, difference_type index) noexcept
+    : m_Parent{ std::addressof(parent) }
+    , m_Index{ index }
+  {
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] typename SplitIndex<CharType, TraitType>::Iterator::value_type SplitIndex<CharType, TraitType>::Iterator::operator*() const noexcept
+  {
+    return (*m_Parent)[static_cast<size_type>(m_Index)];
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] typename SplitIndex<CharType, TraitType>::Iterator::value_type SplitIndex<CharType, TraitType>::Iterator::operator[](difference_type offset) const noexcept
+  {
+    return (*m_Parent)[static_cast<size_type>(m_Index + offset)];
+  }
+
+  template <typename CharType, typename TraitType>
+  typename SplitIndex<CharType, TraitType>::Iterator& SplitIndex<CharType, TraitType>::Iterator::operator++() noexcept
+  {
+    ++m_Index;
+    return *this;
+  }
+
+  template <typename CharType, typename TraitType>
+  typename SplitIndex<CharType, TraitType>::Iterator SplitIndex<CharType, TraitType>::Iterator::operator++(int32_t) noexcept
+  {
+    Iterator previous = *this;
+    ++m_Index;
+    return previous;
+  }
+
+  template <typename CharType, typename TraitType>
+  typename SplitIndex<CharType, TraitType>::Iterator& SplitIndex<CharType, TraitType>::Iterator::operator--() noexcept
+  {
+    --m_Index;
+    return *this;
+  }
+
+  template <typename CharType, typename TraitType>
+  typename SplitIndex<CharType, TraitType>::Iterator SplitIndex<CharType, TraitType>::Iterator::operator--(int32_t) noexcept
+  {
+    Iterator previous = *this;
+    --m_Index;
+    return previous;
+  }
+
+  template <typename CharType, typename TraitType>
+  typename SplitIndex<CharType, TraitType>::Iterator& SplitIndex<CharType, TraitType>::Iterator::operator+=(difference_type offset) noexcept
+  {
+    m_Index += offset;
+    return *this;
+  }
+
+  template <typename CharType, typename TraitType>
+  typename SplitIndex<CharType, TraitType>::Iterator& SplitIndex<CharType, TraitType>::Iterator::operator-=(difference_type offset) noexcept
+  {
+    m_Index -= offset;
+    return *this;
+  }
+} // namespace Cxx::Algorithms::V1
@@ -0,0 +1,377 @@
+namespace Cxx::Algorithms::V1::Details
+{
+  template <typename CharType>
+  [[nodiscard]] inline constexpr bool IsWhiteSpace(const CharType character) noexcept
+  {
+    return character == CharType{ ' ' } or (character >= CharType{ '\t' } and character <= CharType{ '\r' });
+  }
+
+  template <StringSplitOptions Options, typename CharType, typename TraitType>
+  [[nodiscard]] inline constexpr std::basic_string_view<CharType, TraitType> ApplyTokenOptions(std::basic_string_view<CharType, TraitType> token) noexcept
+  {
+    if constexpr ( HasOption(Options, StringSplitOptions::TrimEntries) )
+    {
+      const CharType* first = token.data();
+      const CharType* last  = first + token.size();
+
+      while ( first != last and IsWhiteSpace(*first) )
+      {
+        ++first;
+      }
+
+      while ( first != last and IsWhiteSpace(*(last - 1)) )
+      {
+        --last;
+      }
+
+      return std::basic_string_view<CharType, TraitType>{ first, static_cast<size_t>(last - first) };
+    }
+    else
+    {
+      return token;
+    }
+  }
+} // namespace Cxx::Algorithms::V1::Details
+
+namespace Cxx::Algorithms::Searchers
+{
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> CharacterSearcher<CharType, TraitType>::operator()(const CharType* first, const CharType* last) const noexcept
+  {
+    const CharType* position = TraitType::find(first, static_cast<size_t>(last - first), Delimiter);
+
+    if ( position == nullptr )
+    {
+      return { last, last };
+    }
+
+    return { position, position + 1 };
+  }
+
+  template <typename CharType, typename TraitType>
+  constexpr AnyOfSearcher<CharType, TraitType>::AnyOfSearcher(std::basic_string_view<CharType, TraitType> delimiters) noexcept(sizeof(CharType) == 1)
+  {
+    for ( const CharType delimiter : delimiters )
+    {
+      const auto code = static_cast<std::make_unsigned_t<CharType>>(delimiter);
+
+      if constexpr ( sizeof(CharType) == 1 )
+      {
+        m_Table[code] = true;
+      }
+      else if ( code < m_Table.size() )
+      {
+        m_Table[code] = true;
+      }
+      else
+      {
+        m_Extended.push_back(delimiter);
+      }
+    }
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] constexpr bool AnyOfSearcher<CharType, TraitType>::Contains(const CharType character) const noexcept
+  {
+    const auto code = static_cast<std::make_unsigned_t<CharType>>(character);
+
+    if constexpr ( sizeof(CharType) == 1 )
+    {
+      return m_Table[code];
+    }
+    else
+    {
+      return code < m_Table.size() ? m_Table[code] : std::ranges::find(m_Extended, character) != m_Extended.end();
+    }
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> AnyOfSearcher<CharType, TraitType>::operator()(const CharType* first, const CharType* last) const noexcept
+  {
+    for ( ; first != last; ++first )
+    {
+      if ( Contains(*first) )
+      {
+        return { first, first + 1 };
+      }
+    }
+
+    return { last, last };
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> SubstringSearcher<CharType, TraitType>::operator()(const CharType* first, const CharType* last) const noexcept
+  {
+    const size_t pattern_size = Pattern.size();
+
+    if ( pattern_size == 0 )
+    {
+      return { first, first };
+    }
+
+    while ( static_cast<size_t>(last - first) >= pattern_size )
+    {
+      first = TraitType::find(first, static_cast<size_t>(last - first) - pattern_size + 1, Pattern.front());
+
+      if ( first == nullptr )
+      {
+        break;
+      }
+
+      if ( TraitType::compare(first + 1, Pattern.data() + 1, pattern_size - 1) == 0 )
+      {
+        return { first, first + pattern_size };
+      }
+
+      ++first;
+    }
+
+    return { last, last };
+  }
+
+  template <typename CharType, typename TraitType>
+  constexpr HorspoolSearcher<CharType, TraitType>::HorspoolSearcher(std::basic_string_view<CharType, TraitType> pattern) noexcept
+    : m_Pattern{ pattern }
+  {
+    m_Shifts.fill(pattern.size());
+
+    // Los índices crecientes producen desplazamientos decrecientes: cada entrada conserva el menor desplazamiento.
+    for ( size_t index = 0; index + 1 < pattern.size(); ++index )
+    {
+      m_Shifts[TableIndex(pattern[index])] = pattern.size() - 1 - index;
+    }
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] inline constexpr size_t HorspoolSearcher<CharType, TraitType>::TableIndex(const CharType character) noexcept
+  {
+    return static_cast<size_t>(static_cast<std::make_unsigned_t<CharType>>(character) & 0xFFu);
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> HorspoolSearcher<CharType, TraitType>::operator()(const CharType* first, const CharType* last) const noexcept
+  {
+    const size_t pattern_size = m_Pattern.size();
+
+    if ( pattern_size == 0 )
+    {
+      return { first, first };
+    }
+
+    if ( static_cast<size_t>(last - first) < pattern_size )
+    {
+      return { last, last };
+    }
+
+    const CharType  pattern_last = m_Pattern.back();
+    const CharType* limit        = last - pattern_size;
+
+    while ( first <= limit )
+    {
+      const CharType candidate = first[pattern_size - 1];
+
+      if ( TraitType::eq(candidate, pattern_last) and TraitType::compare(first, m_Pattern.data(), pattern_size - 1) == 0 )
+      {
+        return { first, first + pattern_size };
+      }
+
+      const size_t shift = m_Shifts[TableIndex(candidate)];
+
+      if ( static_cast<size_t>(limit - first) < shift )
+      {
+        break;
+      }
+
+      first += shift;
+    }
+
+    return { last, last };
+  }
+
+  template <typename CharType, typename TraitType>
+  constexpr PatternSearcher<CharType, TraitType>::PatternSearcher(std::basic_string_view<CharType, TraitType> pattern) noexcept
+    : m_Strategy{ SelectStrategy(pattern) }
+    , m_Pattern{ pattern }
+    , m_Horspool{ m_Strategy == Strategy::Horspool ? HorspoolSearcher<CharType, TraitType>{ pattern } : HorspoolSearcher<CharType, TraitType>{} }
+  {
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] inline constexpr typename PatternSearcher<CharType, TraitType>::Strategy PatternSearcher<CharType, TraitType>::SelectStrategy(std::basic_string_view<CharType, TraitType> pattern) noexcept
+  {
+    if ( pattern.size() == 1 )
+    {
+      return Strategy::Character;
+    }
+
+    if ( pattern.size() >= HorspoolThreshold and std::same_as<TraitType, std::char_traits<CharType>> )
+    {
+      return Strategy::Horspool;
+    }
+
+    return Strategy::Substring;
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> PatternSearcher<CharType, TraitType>::operator()(const CharType* first, const CharType* last) const noexcept
+  {
+    switch ( m_Strategy )
+    {
+      case Strategy::Character:
+        return CharacterSearcher<CharType, TraitType>{ m_Pattern.front() }(first, last);
+
+      case Strategy::Horspool:
+        return m_Horspool(first, last);
+
+      case Strategy::Substring:
+      default:
+        return SubstringSearcher<CharType, TraitType>{ m_Pattern }(first, last);
+    }
+  }
+} // namespace Cxx::Algorithms::Searchers
+
+namespace Cxx::Algorithms::Views
+{
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr SplitView<CharType, TraitType, Searcher, Options>::SplitView(string_view_type text, Searcher searcher, size_t max_count) noexcept(std::is_nothrow_move_constructible_v<Searcher>)
+    : m_Text{ text }
+    , m_Searcher{ std::move(searcher) }
+    , m_MaxCount{ max_count }
+  {
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] constexpr typename SplitView<CharType, TraitType, Searcher, Options>::Iterator SplitView<CharType, TraitType, Searcher, Options>::begin() const
+  {
+    if ( m_MaxCount == 0 )
+    {
+      return end();
+    }
+
+    const const_pointer first = m_Text.data();
+    return Iterator{ *this, first, FindNext(first), false, m_MaxCount };
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] constexpr typename SplitView<CharType, TraitType, Searcher, Options>::Iterator SplitView<CharType, TraitType, Searcher, Options>::end() const noexcept
+  {
+    const const_pointer last = m_Text.data() + m_Text.size();
+    return Iterator{ *this, last, match_type{ last, last }, false, 0 };
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] constexpr typename SplitView<CharType, TraitType, Searcher, Options>::string_view_type SplitView<CharType, TraitType, Searcher, Options>::base() const noexcept
+  {
+    return m_Text;
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr typename SplitView<CharType, TraitType, Searcher, Options>::match_type SplitView<CharType, TraitType, Searcher, Options>::FindNext(const_pointer position) const
+  {
+    const const_pointer last = m_Text.data() + m_Text.size();
+
+    auto [match_first, match_last] = std::invoke(m_Searcher, position, last);
+
+    // Igual que std::views::split: un patrón vacío separa la cadena en caracteres individuales.
+    if ( match_first != last and match_first == match_last )
+    {
+      ++match_first;
+      ++match_last;
+    }
+
+    return { match_first, match_last };
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr SplitView<CharType, TraitType, Searcher, Options>::Iterator::Iterator(const SplitView& parent, const_pointer current, match_type next, bool trailing_empty, size_t remaining) noexcept
+    : m_Parent{ std::addressof(parent) }
+    , m_Current{ current }
+    , m_Next{ next }
+    , m_TrailingEmpty{ trailing_empty }
+    , m_Remaining{ remaining }
+  {
+    SkipEmptyEntries();
+    ApplyMaxCount();
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] constexpr typename SplitView<CharType, TraitType, Searcher, Options>::Iterator::value_type SplitView<CharType, TraitType, Searcher, Options>::Iterator::operator*() const noexcept
+  {
+    return Details::ApplyTokenOptions<Options>(value_type{ m_Current, static_cast<size_t>(m_Next.first - m_Current) });
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr typename SplitView<CharType, TraitType, Searcher, Options>::Iterator& SplitView<CharType, TraitType, Searcher, Options>::Iterator::operator++()
+  {
+    --m_Remaining;
+    Advance();
+    SkipEmptyEntries();
+    ApplyMaxCount();
+    return *this;
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr typename SplitView<CharType, TraitType, Searcher, Options>::Iterator SplitView<CharType, TraitType, Searcher, Options>::Iterator::operator++(int32_t)
+  {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] constexpr bool SplitView<CharType, TraitType, Searcher, Options>::Iterator::operator==(const Iterator& right) const noexcept
+  {
+    return m_Current == right.m_Current and m_TrailingEmpty == right.m_TrailingEmpty;
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr void SplitView<CharType, TraitType, Searcher, Options>::Iterator::Advance()
+  {
+    const const_pointer last = m_Parent->m_Text.data() + m_Parent->m_Text.size();
+
+    m_Current = m_Next.first;
+
+    if ( m_Current == last )
+    {
+      m_TrailingEmpty = false;
+      return;
+    }
+
+    m_Current = m_Next.second;
+
+    if ( m_Current == last )
+    {
+      m_TrailingEmpty = true;
+      m_Next          = { m_Current, m_Current };
+    }
+    else
+    {
+      m_Next = m_Parent->FindNext(m_Current);
+    }
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr void SplitView<CharType, TraitType, Searcher, Options>::Iterator::SkipEmptyEntries()
+  {
+    if constexpr ( HasOption(Options, StringSplitOptions::RemoveEmptyEntries) )
+    {
+      const const_pointer last = m_Parent->m_Text.data() + m_Parent->m_Text.size();
+
+      while ( (m_Current != last or m_TrailingEmpty) and (**this).empty() )
+      {
+        Advance();
+      }
+    }
+  }
+
+  template <typename CharType, typename TraitType, typename Searcher, StringSplitOptions Options>
+  constexpr void SplitView<CharType, TraitType, Searcher, Options>::Iterator::ApplyMaxCount() noexcept
+  {
+    // El último Token permitido se extiende hasta el final de la cadena, igual que String.Split(separator, count, options) de .NET.
+    if ( m_Remaining == 1 )
+    {
+      const const_pointer last = m_Parent->m_Text.data() + m_Parent->m_Text.size();
+      m_Next                   = { last, last };
+    }
+  }
+} // namespace Cxx::Algorithms::Views
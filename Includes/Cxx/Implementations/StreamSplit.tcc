@@ -0,0 +1,164 @@
+namespace Cxx::Algorithms::Readers
+{
+  template <typename CharType, typename TraitType>
+  constexpr StreamReader<CharType, TraitType>::StreamReader(std::basic_istream<CharType, TraitType>& stream) noexcept
+    : m_Stream{ std::addressof(stream) }
+  {
+  }
+
+  template <typename CharType, typename TraitType>
+  [[nodiscard]] size_t StreamReader<CharType, TraitType>::Read(CharType* buffer, size_t count)
+  {
+    try
+    {
+      m_Stream->read(buffer, static_cast<std::streamsize>(count));
+    }
+    catch ( const std::ios_base::failure& failure )
+    {
+      // Si el flujo tiene activadas las excepciones de failbit o eofbit, llegar al final de los datos no es un error.
+      if ( m_Stream->bad() )
+      {
+        throw IOException(failure.code());
+      }
+    }
+
+    if ( m_Stream->bad() )
+    {
+      throw IOException(std::make_error_code(std::io_errc::stream));
+    }
+
+    return static_cast<size_t>(m_Stream->gcount());
+  }
+} // namespace Cxx::Algorithms::Readers
+
+namespace Cxx::Algorithms::Views
+{
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::StreamSplitView(Reader reader, Searcher searcher, size_t overlap, size_t buffer_size)
+    : m_Reader{ std::move(reader) }
+    , m_Searcher{ std::move(searcher) }
+    , m_Overlap{ overlap }
+    , m_Capacity{ std::max(buffer_size, overlap + 1) }
+    , m_Buffer{ std::make_unique_for_overwrite<CharType[]>(m_Capacity) }
+  {
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] typename StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::begin()
+  {
+    m_HasToken = Next();
+    return Iterator{ *this };
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  bool StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Next()
+  {
+    while ( true )
+    {
+      const CharType* const buffer = m_Buffer.get();
+      const CharType* const last   = buffer + m_Last;
+
+      auto [match_first, match_last] = std::invoke(m_Searcher, buffer + m_Scan, last);
+
+      if ( match_first != last )
+      {
+        const bool empty_match = match_first == match_last;
+
+        // Igual que Views::SplitView: un patrón vacío separa los datos en caracteres individuales.
+        if ( empty_match )
+        {
+          ++match_first;
+          ++match_last;
+        }
+
+        m_Token          = string_view_type{ buffer + m_First, static_cast<size_t>(match_first - (buffer + m_First)) };
+        m_First          = static_cast<size_t>(match_last - buffer);
+        m_Scan           = m_First;
+        m_AfterDelimiter = not empty_match;
+      }
+      else if ( not m_EndOfData )
+      {
+        // Un delimitador que empieza antes de last - m_Overlap ya habría sido encontrado, no es necesario volver a buscarlo.
+        m_Scan = std::max(m_First, m_Last - std::min(m_Last, m_Overlap));
+        Refill();
+        continue;
+      }
+      else
+      {
+        // Igual que Views::SplitView: los datos vacíos no producen Tokens y un delimitador al final produce un Token vacío.
+        if ( m_First == m_Last and not m_AfterDelimiter )
+        {
+          return false;
+        }
+
+        m_Token          = string_view_type{ buffer + m_First, m_Last - m_First };
+        m_First          = m_Last;
+        m_Scan           = m_Last;
+        m_AfterDelimiter = false;
+      }
+
+      m_Token = Details::ApplyTokenOptions<Options>(m_Token);
+
+      if ( not HasOption(Options, StringSplitOptions::RemoveEmptyEntries) or not m_Token.empty() )
+      {
+        return true;
+      }
+    }
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  void StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Refill()
+  {
+    CharType* const buffer = m_Buffer.get();
+
+    // El Token incompleto se mueve al inicio del buffer para liberar el resto del espacio.
+    if ( m_First > 0 )
+    {
+      TraitType::move(buffer, buffer + m_First, m_Last - m_First);
+      m_Last -= m_First;
+      m_Scan -= m_First;
+      m_First = 0;
+    }
+
+    if ( m_Last == m_Capacity )
+    {
+      throw IOException(std::make_error_code(std::errc::value_too_large));
+    }
+
+    const size_t count = m_Reader.Read(buffer + m_Last, m_Capacity - m_Last);
+
+    m_EndOfData = count == 0;
+    m_Last += count;
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  constexpr StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator::Iterator(StreamSplitView& parent) noexcept
+    : m_Parent{ std::addressof(parent) }
+  {
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] typename StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator::value_type StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator::operator*() const noexcept
+  {
+    return m_Parent->m_Token;
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  typename StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator& StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator::operator++()
+  {
+    m_Parent->m_HasToken = m_Parent->Next();
+    return *this;
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  void StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator::operator++(int32_t)
+  {
+    ++*this;
+  }
+
+  template <typename CharType, typename TraitType, typename Reader, typename Searcher, StringSplitOptions Options>
+  [[nodiscard]] bool StreamSplitView<CharType, TraitType, Reader, Searcher, Options>::Iterator::operator==(std::default_sentinel_t) const noexcept
+  {
+    return not m_Parent->m_HasToken;
+  }
+} // namespace Cxx::Algorithms::Views
@@ -0,0 +1,189 @@
+namespace Cxx::Algorithms::V1
+{
+  template <Concepts::TextCharacter CharType>
+  [[nodiscard]] inline uint64_t Details::StringSortPrefix(const std::basic_string_view<CharType> key, const size_t depth) noexcept
+  {
+    using unsigned_type = std::make_unsigned_t<CharType>;
+
+    constexpr size_t        bits  = sizeof(CharType) * CHAR_BIT;
+    constexpr size_t        count = sizeof(uint64_t) / sizeof(CharType);
+    constexpr unsigned_type sign  = std::is_signed_v<CharType> ? static_cast<unsigned_type>(unsigned_type{ 1 } << (bits - 1)) : unsigned_type{ 0 };
+
+    if constexpr ( sizeof(CharType) == 1 )
+    {
+      // Caso frecuente: quedan al menos 8 bytes y se leen con una sola lectura en orden big-endian.
+      if ( key.size() >= depth + count )
+      {
+        uint64_t prefix = 0;
+        std::memcpy(&prefix, key.data() + depth, sizeof(prefix));
+
+        if constexpr ( std::endian::native == std::endian::little )
+        {
+          prefix = std::byteswap(prefix);
+        }
+
+        return std::is_signed_v<CharType> ? prefix ^ 0x8080808080808080 : prefix;
+      }
+    }
+
+    uint64_t prefix = 0;
+
+    for ( size_t index = 0; index < count; ++index )
+    {
+      prefix <<= bits;
+
+      if ( depth + index < key.size() )
+      {
+        prefix |= static_cast<unsigned_type>(static_cast<unsigned_type>(key[depth + index]) ^ sign);
+      }
+    }
+
+    return prefix;
+  }
+
+  template <Concepts::TextCharacter CharType>
+  void Details::MultikeyQuicksort(std::span<StringSortEntry<CharType>> entries, size_t depth, bool cached, size_t budget)
+  {
+    using entry_type = StringSortEntry<CharType>;
+
+    constexpr size_t count          = sizeof(uint64_t) / sizeof(CharType);
+    constexpr size_t insertion_size = 16;
+
+    while ( entries.size() > 1 )
+    {
+      if ( not cached )
+      {
+        for ( entry_type& entry : entries )
+        {
+          entry.Prefix = StringSortPrefix(entry.Key, depth);
+        }
+
+        cached = true;
+      }
+
+      if ( entries.size() <= insertion_size or budget == 0 )
+      {
+        // Un prefijo distinto decide el orden; con prefijos iguales se compara el resto de la clave desde depth.
+        const auto less = [depth](const entry_type& left, const entry_type& right)
+        {
+          if ( left.Prefix != right.Prefix )
+          {
+            return left.Prefix < right.Prefix;
+          }
+
+          return std::is_lt(Cxx::Algorithms::RangeCompare(left.Key.substr(std::min(depth, left.Key.size())), right.Key.substr(std::min(depth, right.Key.size()))));
+        };
+
+        if ( budget == 0 )
+        {
+          std::ranges::sort(entries, less);
+          return;
+        }
+
+        for ( size_t index = 1; index < entries.size(); ++index )
+        {
+          entry_type entry    = entries[index];
+          size_t     position = index;
+
+          for ( ; position > 0 and less(entry, entries[position - 1]); --position )
+          {
+            entries[position] = entries[position - 1];
+          }
+
+          entries[position] = entry;
+        }
+
+        return;
+      }
+
+      --budget;
+
+      // Partición en 3 grupos alrededor de la mediana de 3 prefijos: [0, lower) < pivote, [lower, upper) == pivote y [upper, size) > pivote.
+      const uint64_t first  = entries.front().Prefix;
+      const uint64_t middle = entries[entries.size() / 2].Prefix;
+      const uint64_t last   = entries.back().Prefix;
+      const uint64_t pivot  = std::max(std::min(first, middle), std::min(std::max(first, middle), last));
+
+      size_t lower = 0;
+      size_t upper = entries.size();
+
+      for ( size_t index = 0; index < upper; )
+      {
+        if ( entries[index].Prefix < pivot )
+        {
+          std::swap(entries[lower++], entries[index++]);
+        }
+        else if ( entries[index].Prefix > pivot )
+        {
+          std::swap(entries[index], entries[--upper]);
+        }
+        else
+        {
+          ++index;
+        }
+      }
+
+      // Los grupos < y > siguen en la misma profundidad y su prefijo ya está calculado.
+      MultikeyQuicksort(entries.first(lower), depth, true, budget);
+      MultikeyQuicksort(entries.subspan(upper), depth, true, budget);
+
+      // En el grupo igual las claves que terminan dentro del prefijo son prefijo de las demás, por lo que van primero y solo se
+      // ordenan por longitud. El resto avanza a los siguientes 8 bytes.
+      const std::span<entry_type> equal = entries.subspan(lower, upper - lower);
+      const auto                  rest  = std::ranges::partition(equal, [depth](const entry_type& entry) { return entry.Key.size() <= depth + count; });
+      const auto                  ended = static_cast<size_t>(rest.begin() - equal.begin());
+
+      std::ranges::sort(equal.first(ended), std::less{}, [](const entry_type& entry) { return entry.Key.size(); });
+
+      entries = equal.subspan(ended);
+      depth += count;
+      cached = false;
+      budget = static_cast<size_t>(2 * std::bit_width(entries.size()));
+    }
+  }
+
+  template <Details::SizedRandomAccessRange Range, typename Projection>
+  requires std::permutable<std::ranges::iterator_t<Range>> and std::invocable<Projection&, std::ranges::range_reference_t<Range>> and
+           Concepts::StringViewCompatible<std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>> and
+           Concepts::TextCharacter<Traits::CharacterTypeOf<std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>>>
+  inline Range& SortStrings(Range& Items, Projection&& Key)
+  {
+    using key_type   = std::invoke_result_t<Projection&, std::ranges::range_reference_t<Range>>;
+    using CharType   = Traits::CharacterTypeOf<key_type>;
+    using StringView = std::basic_string_view<CharType, Traits::CharacterTraitsOf<key_type>>;
+    using entry_type = Details::StringSortEntry<CharType>;
+
+    // Una proyección que regresa una cadena por valor (por ejemplo std::string) necesita guardar las claves mientras se ordena.
+    constexpr bool owning_key = not std::is_reference_v<key_type> and not std::ranges::borrowed_range<key_type> and not std::is_pointer_v<std::decay_t<key_type>>;
+
+    const auto first = std::ranges::begin(Items);
+    const auto size  = static_cast<size_t>(std::ranges::size(Items));
+    const auto at    = [first](const size_t index) { return first + static_cast<std::ranges::range_difference_t<Range>>(index); };
+
+    std::vector<std::conditional_t<owning_key, std::remove_cvref_t<key_type>, StringView>> keys;
+    keys.reserve(size);
+
+    for ( size_t index = 0; index < size; ++index )
+    {
+      keys.emplace_back(std::invoke(Key, *at(index)));
+    }
+
+    std::vector<entry_type> entries;
+    entries.reserve(size);
+
+    for ( size_t index = 0; index < size; ++index )
+    {
+      const StringView key{ keys[index] };
+      entries.push_back(entry_type{ 0, std::basic_string_view<CharType>{ key.data(), key.size() }, index });
+    }
+
+    Details::MultikeyQuicksort(std::span<entry_type>{ entries }, 0, false, static_cast<size_t>(2 * std::bit_width(size)));
+
+    std::vector<size_t> order(size);
+    std::ranges::transform(entries, order.begin(), &entry_type::Index);
+
+    Details::PermuteInPlace(first, order);
+
+    return Items;
+  }
+} // namespace Cxx::Algorithms::V1
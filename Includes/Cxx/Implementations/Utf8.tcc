@@ -0,0 +1,222 @@
+namespace Cxx::Algorithms::V1::Details
+{
+  template <typename CharType>
+  [[nodiscard]] inline constexpr Utf8Sequence DecodeUtf8(const CharType* first, const CharType* last) noexcept
+  {
+    const auto lead = static_cast<uint8_t>(*first);
+
+    if ( lead < 0x80 )
+    {
+      return Utf8Sequence{ lead, 1, true };
+    }
+
+    // Longitud de la secuencia y rango permitido de la segunda unidad de código según la unidad inicial (Unicode, tabla 3-7).
+    // Los rangos reducidos de la segunda unidad descartan las secuencias sobrelargas, los sustitutos y los valores > U+10FFFF.
+    uint8_t  length     = 0;
+    uint8_t  lower      = 0x80;
+    uint8_t  upper      = 0xBF;
+    char32_t code_point = 0;
+
+    if ( lead >= 0xC2 and lead <= 0xDF )
+    {
+      length     = 2;
+      code_point = lead & 0x1F;
+    }
+    else if ( lead >= 0xE0 and lead <= 0xEF )
+    {
+      length     = 3;
+      code_point = lead & 0x0F;
+      lower      = lead == 0xE0 ? 0xA0 : 0x80;
+      upper      = lead == 0xED ? 0x9F : 0xBF;
+    }
+    else if ( lead >= 0xF0 and lead <= 0xF4 )
+    {
+      length     = 4;
+      code_point = lead & 0x07;
+      lower      = lead == 0xF0 ? 0x90 : 0x80;
+      upper      = lead == 0xF4 ? 0x8F : 0xBF;
+    }
+    else
+    {
+      return Utf8Sequence{ ReplacementCharacter, 1, false };
+    }
+
+    for ( uint8_t index = 1; index < length; ++index )
+    {
+      if ( first + index == last )
+      {
+        return Utf8Sequence{ ReplacementCharacter, index, false };
+      }
+
+      const auto unit = static_cast<uint8_t>(first[index]);
+
+      if ( unit < lower or unit > upper )
+      {
+        return Utf8Sequence{ ReplacementCharacter, index, false };
+      }
+
+      code_point = (code_point << 6) | (unit & 0x3F);
+      lower      = 0x80;
+      upper      = 0xBF;
+    }
+
+    return Utf8Sequence{ code_point, length, true };
+  }
+
+  template <typename CharType>
+  inline constexpr size_t EncodeUtf8(char32_t code_point, CharType* output) noexcept
+  {
+    if ( code_point < 0x80 )
+    {
+      output[0] = static_cast<CharType>(code_point);
+      return 1;
+    }
+
+    if ( code_point < 0x800 )
+    {
+      output[0] = static_cast<CharType>(0xC0 | (code_point >> 6));
+      output[1] = static_cast<CharType>(0x80 | (code_point & 0x3F));
+      return 2;
+    }
+
+    if ( (code_point >= 0xD800 and code_point <= 0xDFFF) or code_point > 0x10FFFF )
+    {
+      code_point = ReplacementCharacter;
+    }
+
+    if ( code_point < 0x10000 )
+    {
+      output[0] = static_cast<CharType>(0xE0 | (code_point >> 12));
+      output[1] = static_cast<CharType>(0x80 | ((code_point >> 6) & 0x3F));
+      output[2] = static_cast<CharType>(0x80 | (code_point & 0x3F));
+      return 3;
+    }
+
+    output[0] = static_cast<CharType>(0xF0 | (code_point >> 18));
+    output[1] = static_cast<CharType>(0x80 | ((code_point >> 12) & 0x3F));
+    output[2] = static_cast<CharType>(0x80 | ((code_point >> 6) & 0x3F));
+    output[3] = static_cast<CharType>(0x80 | (code_point & 0x3F));
+    return 4;
+  }
+} // namespace Cxx::Algorithms::V1::Details
+
+namespace Cxx::Algorithms::Searchers
+{
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  constexpr CodePointSearcher<CharType, TraitType>::CodePointSearcher(char32_t code_point) noexcept
+    : m_Size{ Details::EncodeUtf8(code_point, m_Units.data()) }
+  {
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr std::pair<const CharType*, const CharType*> CodePointSearcher<CharType, TraitType>::operator()(const CharType* first, const CharType* last) const noexcept
+  {
+    if ( m_Size == 0 )
+    {
+      return { first, first };
+    }
+
+    while ( static_cast<size_t>(last - first) >= m_Size )
+    {
+      first = TraitType::find(first, static_cast<size_t>(last - first) - m_Size + 1, m_Units[0]);
+
+      if ( first == nullptr )
+      {
+        break;
+      }
+
+      if ( TraitType::compare(first + 1, m_Units.data() + 1, m_Size - 1) == 0 )
+      {
+        return { first, first + m_Size };
+      }
+
+      ++first;
+    }
+
+    return { last, last };
+  }
+} // namespace Cxx::Algorithms::Searchers
+
+namespace Cxx::Algorithms::Views
+{
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  constexpr CodePointView<CharType, TraitType>::CodePointView(string_view_type text) noexcept
+    : m_Text{ text }
+  {
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr typename CodePointView<CharType, TraitType>::Iterator CodePointView<CharType, TraitType>::begin() const noexcept
+  {
+    return Iterator{ m_Text.data(), m_Text.data() + m_Text.size() };
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr typename CodePointView<CharType, TraitType>::Iterator CodePointView<CharType, TraitType>::end() const noexcept
+  {
+    return Iterator{ m_Text.data() + m_Text.size(), m_Text.data() + m_Text.size() };
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr typename CodePointView<CharType, TraitType>::string_view_type CodePointView<CharType, TraitType>::base() const noexcept
+  {
+    return m_Text;
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  constexpr CodePointView<CharType, TraitType>::Iterator::Iterator(const_pointer current, const_pointer last) noexcept
+    : m_Current{ current }
+    , m_Last{ last }
+  {
+    Decode();
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr typename CodePointView<CharType, TraitType>::Iterator::value_type CodePointView<CharType, TraitType>::Iterator::operator*() const noexcept
+  {
+    return m_Sequence.CodePoint;
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  constexpr typename CodePointView<CharType, TraitType>::Iterator& CodePointView<CharType, TraitType>::Iterator::operator++() noexcept
+  {
+    m_Current += m_Sequence.Length;
+    Decode();
+    return *this;
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  constexpr typename CodePointView<CharType, TraitType>::Iterator CodePointView<CharType, TraitType>::Iterator::operator++(int32_t) noexcept
+  {
+    Iterator previous = *this;
+    ++*this;
+    return previous;
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr bool CodePointView<CharType, TraitType>::Iterator::operator==(const Iterator& right) const noexcept
+  {
+    return m_Current == right.m_Current;
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr typename CodePointView<CharType, TraitType>::const_pointer CodePointView<CharType, TraitType>::Iterator::base() const noexcept
+  {
+    return m_Current;
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  [[nodiscard]] constexpr typename CodePointView<CharType, TraitType>::string_view_type CodePointView<CharType, TraitType>::Iterator::Units() const noexcept
+  {
+    return string_view_type{ m_Current, m_Sequence.Length };
+  }
+
+  template <Concepts::Utf8CodeUnit CharType, typename TraitType>
+  constexpr void CodePointView<CharType, TraitType>::Iterator::Decode() noexcept
+  {
+    if ( m_Current != m_Last )
+    {
+      m_Sequence = Details::DecodeUtf8(m_Current, m_Last);
+    }
+  }
+} // namespace Cxx::Algorithms::Views
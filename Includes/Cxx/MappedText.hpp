@@ -0,0 +1,126 @@
+#ifndef AC4FF9CA_F614_4FDE_B547_6D044944A207
+#define AC4FF9CA_F614_4FDE_B547_6D044944A207
+
+#include "Utility.hpp"
+#include "Exceptions/IOException.hpp"
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace Cxx
+{
+  /**
+   * @brief Archivo de texto proyectado en memoria de solo lectura (mmap).
+   *
+   *  Permite recorrer o separar en Tokens un archivo sin copiar su contenido a un std::string: las páginas se cargan bajo
+   *  demanda desde la caché del sistema, por lo que el consumo de memoria no se duplica.
+   *
+   *  El contenido siempre termina en '\0', incluso si el tamaño del archivo es múltiplo del tamaño de página, de modo que
+   *  puede usarse como Cxx::ZString<char>. También es compatible con Concepts::StringViewCompatible, por ejemplo:
+   *
+   *    MappedText text{ "Logs.txt" };
+   *    text.Advise(MappedText::Advice::Sequential);
+   *
+   *    for ( std::string_view line : Algorithms::Split(text, '\n') ) { ... }
+   *
+   *  Los std::string_view obtenidos solo son válidos mientras exista el objeto MappedText. Si otro proceso trunca el archivo
+   *  mientras está proyectado, el acceso a las páginas eliminadas termina el programa con SIGBUS.
+   */
+  class MappedText
+  {
+    public:
+      using value_type      = char;
+      using traits_type     = std::char_traits<char>;
+      using pointer         = const char*;
+      using const_pointer   = const char*;
+      using reference       = const char&;
+      using const_reference = const char&;
+      using iterator        = const char*;
+      using const_iterator  = const char*;
+      using size_type       = std::size_t;
+      using difference_type = std::ptrdiff_t;
+
+      /**
+       * @brief Sugerencias al sistema sobre la forma en que se accederá al contenido (madvise).
+       */
+      enum class Advice
+      {
+        /**
+         * @brief Sin sugerencia especial, restaura el comportamiento por defecto.
+         */
+        Normal = 0x0,
+
+        /**
+         * @brief El contenido se recorrerá de principio a fin: el sistema lee por adelantado más páginas (MADV_SEQUENTIAL).
+         */
+        Sequential = 0x1,
+
+        /**
+         * @brief El contenido se accederá en orden aleatorio: el sistema no lee por adelantado (MADV_RANDOM).
+         */
+        Random = 0x2,
+
+        /**
+         * @brief El contenido se necesitará pronto: el sistema empieza a cargarlo de inmediato (MADV_WILLNEED).
+         */
+        WillNeed = 0x4,
+
+        /**
+         * @brief Solicita páginas enormes (Transparent Huge Pages) para reducir los fallos de TLB (MADV_HUGEPAGE).
+         */
+        HugePages = 0x8
+      };
+
+      MappedText() = default;
+
+      /**
+       * @brief Proyecta en memoria el archivo indicado.
+       *
+       * @param[in] path Ruta del archivo a proyectar.
+       *
+       * @throws Cxx::IOException Con el std::error_code del sistema si el archivo no se puede abrir o proyectar.
+       */
+      explicit MappedText(const std::filesystem::path& path);
+
+      MappedText(MappedText&& other) noexcept;
+      MappedText& operator=(MappedText&& other) noexcept;
+
+      MappedText(const MappedText&)            = delete;
+      MappedText& operator=(const MappedText&) = delete;
+
+      ~MappedText();
+
+      /**
+       * @brief Envía una sugerencia de acceso al sistema. Puede llamarse varias veces para combinar sugerencias.
+       *
+       * @param[in] advice Sugerencia a enviar.
+       *
+       * @return Regresa false si el sistema no admite la sugerencia, las sugerencias nunca son obligatorias.
+       */
+      bool Advise(const Advice advice) noexcept;
+
+      [[nodiscard]] const_pointer data() const noexcept;
+      [[nodiscard]] const_pointer c_str() const noexcept;
+      [[nodiscard]] size_type     size() const noexcept;
+      [[nodiscard]] bool          empty() const noexcept;
+
+      [[nodiscard]] const_iterator begin() const noexcept;
+      [[nodiscard]] const_iterator end() const noexcept;
+
+      [[nodiscard]] std::string_view AsStringView() const noexcept;
+      [[nodiscard]] ZString<char>    AsZString() const noexcept;
+
+      [[nodiscard]] operator std::string_view() const noexcept;
+
+    private:
+      void Release() noexcept;
+
+      const char* m_Data{ "" };
+      size_type   m_Size{ 0 };
+      void*       m_Mapping{ nullptr };
+      size_type   m_MappingSize{ 0 };
+  };
+} // namespace Cxx
+
+#endif /* AC4FF9CA_F614_4FDE_B547_6D044944A207 */
@@ -3,6 +3,7 @@
 
 #include "TypeTraits.hpp"
 
+#include <algorithm>
 #include <utility>
 #include <optional>
 #include <tuple>
@@ -227,6 +228,41 @@ namespace Cxx
       size_type     m_Size;
   };
 
+  /**
+   * @brief Cadena de tamaño fijo que puede usarse como parámetro de plantilla (NTTP) de tipo clase.
+   *
+   *  Por ejemplo: template <FixedString Text> struct Header { }; Header<"Content-Type"> header;
+   *
+   *  Como parámetro de plantilla el objeto tiene duración estática, por lo que los std::basic_string_view obtenidos con View()
+   *  son válidos durante toda la ejecución del programa y pueden usarse en expresiones constantes.
+   *
+   * @tparam CharType Tipo del caracter de la cadena.
+   * @tparam Size     Cantidad de caracteres del arreglo, incluyendo el '\0' final.
+   */
+  template <Concepts::Character CharType, size_t Size>
+  struct FixedString
+  {
+      CharType Data[Size]{};
+
+      constexpr FixedString(const CharType (&string)[Size]) noexcept
+      {
+        std::ranges::copy(string, Data);
+      }
+
+      [[nodiscard]] constexpr size_t size() const noexcept
+      {
+        return Size - 1;
+      }
+
+      [[nodiscard]] constexpr std::basic_string_view<CharType> View() const noexcept
+      {
+        return std::basic_string_view<CharType>{ Data, Size - 1 };
+      }
+  };
+
+  template <typename CharType, size_t Size>
+  FixedString(const CharType (&)[Size]) -> FixedString<CharType, Size>;
+
   inline namespace Literals
   {
     inline namespace StringLiterals
@@ -1,6 +1,1442 @@
 #include "Cxx/Algorithms.hpp"
 
+#include <array>
+#include <bit>
+#include <cerrno>
+#include <climits>
+#include <cstring>
+#include <locale>
+#include <utility>
+#include <vector>
+
+#if defined(_WIN32)
+# include <io.h>
+#else
+# include <sys/uio.h>
+# include <unistd.h>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64)
+# include <emmintrin.h>
+#endif
+
+#if defined(__PCLMUL__)
+# include <wmmintrin.h>
+#endif
+
+// El validador UTF-8 con SSSE3 se compila siempre en x86/x64 y se elige en tiempo de ejecución según el procesador.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+# define CXX_ALGORITHMS_UTF8_SSSE3 1
+# include <tmmintrin.h>
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# endif
+# if defined(__GNUC__)
+#  define CXX_TARGET_SSSE3 __attribute__((target("ssse3")))
+# else
+#  define CXX_TARGET_SSSE3
+# endif
+#endif
+
+// El kernel de comparación de bytes con AVX2 también se compila siempre en x86/x64 y se elige en tiempo de ejecución.
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+# define CXX_ALGORITHMS_AVX2 1
+# include <immintrin.h>
+# if defined(__GNUC__)
+#  define CXX_TARGET_AVX2 __attribute__((target("avx2")))
+# else
+#  define CXX_TARGET_AVX2
+# endif
+#endif
+
 namespace Cxx
 {
+  namespace Algorithms::Readers
+  {
+    [[nodiscard]] size_t FileDescriptorReader::Read(char* buffer, size_t count)
+    {
+      while ( true )
+      {
+#if defined(_WIN32)
+        const auto result = ::_read(m_FileDescriptor, buffer, static_cast<uint32_t>(std::min<size_t>(count, INT_MAX)));
+#else
+        const auto result = ::read(m_FileDescriptor, buffer, std::min<size_t>(count, SSIZE_MAX));
+#endif
+
+        if ( result >= 0 )
+        {
+          return static_cast<size_t>(result);
+        }
+
+        if ( errno != EINTR )
+        {
+          throw IOException(std::error_code{ errno, std::generic_category() });
+        }
+      }
+    }
+  } // namespace Algorithms::Readers
+
+  namespace Algorithms::inline V1::Details
+  {
+    void WriteChunks(int32_t file_descriptor, std::span<const std::span<const char>> chunks)
+    {
+#if defined(_WIN32)
+      for ( std::span<const char> chunk : chunks )
+      {
+        while ( not chunk.empty() )
+        {
+          const auto result = ::_write(file_descriptor, chunk.data(), static_cast<uint32_t>(std::min<size_t>(chunk.size(), INT_MAX)));
+
+          if ( result < 0 )
+          {
+            throw IOException(std::error_code{ errno, std::generic_category() });
+          }
+
+          chunk = chunk.subspan(static_cast<size_t>(result));
+        }
+      }
+#else
+      std::array<iovec, WriteChunksBatchSize> vectors;
+
+      for ( size_t first = 0; first < chunks.size(); )
+      {
+        const size_t count = std::min(chunks.size() - first, vectors.size());
+
+        for ( size_t index = 0; index < count; ++index )
+        {
+          vectors[index] = iovec{ const_cast<char*>(chunks[first + index].data()), chunks[first + index].size() };
+        }
+
+        iovec* pending       = vectors.data();
+        size_t pending_count = count;
+
+        while ( pending_count > 0 )
+        {
+          const auto result = ::writev(file_descriptor, pending, static_cast<int32_t>(pending_count));
+
+          if ( result < 0 )
+          {
+            if ( errno == EINTR )
+            {
+              continue;
+            }
+
+            throw IOException(std::error_code{ errno, std::generic_category() });
+          }
+
+          // Escritura parcial: se descartan los fragmentos completos y se ajusta el primero que quedó incompleto.
+          auto remaining = static_cast<size_t>(result);
+
+          while ( pending_count > 0 and remaining >= pending->iov_len )
+          {
+            remaining -= pending->iov_len;
+            ++pending;
+            --pending_count;
+          }
+
+          if ( pending_count > 0 )
+          {
+            pending->iov_base = static_cast<char*>(pending->iov_base) + remaining;
+            pending->iov_len -= remaining;
+          }
+        }
+
+        first += count;
+      }
+#endif
+    }
+  } // namespace Algorithms::inline V1::Details
+
+  namespace Algorithms::inline V1
+  {
+    namespace
+    {
+      constexpr size_t CsvBlockSize = 64;
+
+      /**
+       * @brief Máscara de 64 bits donde el bit i indica si block[i] == character.
+       */
+      [[nodiscard]] inline uint64_t CompareMask(const char* block, const char character) noexcept
+      {
+#if defined(__SSE2__) || defined(_M_X64)
+        const __m128i pattern = _mm_set1_epi8(character);
+        uint64_t      mask    = 0;
+
+        for ( size_t offset = 0; offset < CsvBlockSize; offset += 16 )
+        {
+          const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + offset));
+          mask |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(values, pattern)))) << offset;
+        }
+
+        return mask;
+#else
+        uint64_t mask = 0;
+
+        for ( size_t index = 0; index < CsvBlockSize; ++index )
+        {
+          mask |= static_cast<uint64_t>(block[index] == character) << index;
+        }
+
+        return mask;
+#endif
+      }
+
+      /**
+       * @brief XOR prefijo: el bit i del resultado es el XOR de los bits [0, i] de mask.
+       *
+       *  Aplicado a la máscara de comillas marca los caracteres que están dentro de un campo entre comillas.
+       */
+      [[nodiscard]] inline uint64_t PrefixXor(uint64_t mask) noexcept
+      {
+#if defined(__PCLMUL__)
+        // La multiplicación sin acarreo por ~0 calcula el XOR prefijo en una sola instrucción.
+        const __m128i product = _mm_clmulepi64_si128(_mm_set_epi64x(0, static_cast<int64_t>(mask)), _mm_set1_epi8(static_cast<char>(0xFF)), 0);
+        return static_cast<uint64_t>(_mm_cvtsi128_si64(product));
+#else
+        mask ^= mask << 1;
+        mask ^= mask << 2;
+        mask ^= mask << 4;
+        mask ^= mask << 8;
+        mask ^= mask << 16;
+        mask ^= mask << 32;
+        return mask;
+#endif
+      }
+    } // namespace
+
+    CsvIndex::CsvIndex(std::string_view text, char delimiter, char quote)
+      : m_Text{ text }
+      , m_Delimiter{ delimiter }
+      , m_Quote{ quote }
+    {
+      Scan();
+    }
+
+    void CsvIndex::Scan()
+    {
+      const char* const data = m_Text.data();
+      const size_type   size = m_Text.size();
+
+      size_type field_first = 0;
+      uint64_t  inside      = 0; // 0 ó ~0: indica si el bloque anterior terminó dentro de un campo entre comillas.
+
+      // El último bloque incompleto se copia a un buffer relleno con ceros, que no coinciden con ningún caracter especial.
+      char padded[CsvBlockSize];
+
+      for ( size_type block_first = 0; block_first < size; block_first += CsvBlockSize )
+      {
+        const char* block = data + block_first;
+
+        if ( size - block_first < CsvBlockSize )
+        {
+          std::memset(padded, 0, CsvBlockSize);
+          std::memcpy(padded, block, size - block_first);
+          block = padded;
+        }
+
+        const uint64_t quotes     = CompareMask(block, m_Quote);
+        const uint64_t delimiters = CompareMask(block, m_Delimiter);
+        const uint64_t newlines   = CompareMask(block, '\n');
+
+        const uint64_t quoted = PrefixXor(quotes) ^ inside;
+        inside                = static_cast<uint64_t>(0) - (quoted >> 63);
+
+        for ( uint64_t separators = (delimiters | newlines) & ~quoted; separators != 0; separators &= separators - 1 )
+        {
+          const auto      bit         = static_cast<size_type>(std::countr_zero(separators));
+          const size_type field_last  = block_first + bit;
+          const bool      end_of_row  = ((newlines >> bit) & 1) != 0;
+
+          AppendField(field_first, field_last, end_of_row);
+          field_first = field_last + 1;
+        }
+      }
+
+      // Un salto de línea al final del texto no produce una fila vacía, pero un delimitador al final sí produce un campo vacío.
+      if ( field_first < size or m_Fields.size() > m_RowStarts.back() )
+      {
+        AppendField(field_first, size, true);
+      }
+    }
+
+    void CsvIndex::AppendField(size_type first, size_type last, bool end_of_row)
+    {
+      const char* const data = m_Text.data();
+
+      if ( end_of_row and last > first and data[last - 1] == '\r' )
+      {
+        --last;
+      }
+
+      const bool quoted = last - first >= 2 and data[first] == m_Quote and data[last - 1] == m_Quote;
+
+      if ( quoted )
+      {
+        ++first;
+        --last;
+      }
+
+      m_Fields.emplace_back(data + first, data + last);
+
+      if ( end_of_row )
+      {
+        m_RowStarts.push_back(m_Fields.size());
+      }
+    }
+
+    [[nodiscard]] CsvIndex::size_type CsvIndex::RowCount() const noexcept
+    {
+      return m_RowStarts.size() - 1;
+    }
+
+    [[nodiscard]] CsvIndex::size_type CsvIndex::FieldCount() const noexcept
+    {
+      return m_Fields.size();
+    }
+
+    [[nodiscard]] CsvIndex::size_type CsvIndex::ColumnCount(size_type row) const noexcept
+    {
+      return m_RowStarts[row + 1] - m_RowStarts[row];
+    }
+
+    [[nodiscard]] std::string_view CsvIndex::Field(size_type row, size_type column) const noexcept
+    {
+      const field_type& field = m_Fields[m_RowStarts[row] + column];
+      return std::string_view{ field.begin(), field.end() };
+    }
+
+    [[nodiscard]] bool CsvIndex::IsQuoted(size_type row, size_type column) const noexcept
+    {
+      // Sin comillas, el caracter anterior al campo es un delimitador o un salto de línea, nunca una comilla.
+      const char* const first = m_Fields[m_RowStarts[row] + column].begin();
+      return first != m_Text.data() and first[-1] == m_Quote;
+    }
+
+    [[nodiscard]] std::string CsvIndex::UnescapedField(size_type row, size_type column) const
+    {
+      const std::string_view field = Field(row, column);
+      return IsQuoted(row, column) ? Unescape(field, m_Quote) : std::string{ field };
+    }
+
+    [[nodiscard]] std::string_view CsvIndex::base() const noexcept
+    {
+      return m_Text;
+    }
+
+    [[nodiscard]] std::string CsvIndex::Unescape(std::string_view field, char quote)
+    {
+      std::string result;
+      result.reserve(field.size());
+
+      for ( size_type position = 0; position < field.size(); )
+      {
+        const size_type next = field.find(quote, position);
+
+        if ( next == field.npos or next + 1 == field.size() )
+        {
+          result.append(field.substr(position));
+          break;
+        }
+
+        // Se copia el tramo hasta la comilla inclusive y se omite la segunda comilla del par.
+        result.append(field.substr(position, next + 1 - position));
+        position = field[next + 1] == quote ? next + 2 : next + 1;
+      }
+
+      return result;
+    }
+
+    namespace
+    {
+      constexpr size_t Utf8BlockSize = 64;
+
+      /**
+       * @brief Inicio de la secuencia UTF-8 que puede continuar en la unidad de código position.
+       *
+       *  Las unidades anteriores a position ya fueron validadas, por lo que solo la última secuencia (de 3 unidades como
+       *  máximo) puede estar incompleta: basta con buscar el primer inicio de secuencia de las 3 unidades anteriores.
+       */
+      [[nodiscard]] inline size_t Utf8SequenceStart(const unsigned char* data, const size_t position) noexcept
+      {
+        size_t start = position < 3 ? 0 : position - 3;
+
+        while ( start < position and (data[start] & 0xC0) == 0x80 )
+        {
+          ++start;
+        }
+
+        return start;
+      }
+
+      [[nodiscard]] size_t FindInvalidUtf8Scalar(const unsigned char* data, size_t position, const size_t size) noexcept
+      {
+        constexpr uint64_t high_bits = 0x8080808080808080;
+
+        while ( position < size )
+        {
+          // Los tramos ASCII se descartan de 16 en 16 bytes.
+          if ( size - position >= 16 )
+          {
+            uint64_t low  = 0;
+            uint64_t high = 0;
+            std::memcpy(&low, data + position, 8);
+            std::memcpy(&high, data + position + 8, 8);
+
+            if ( ((low | high) & high_bits) == 0 )
+            {
+              position += 16;
+              continue;
+            }
+          }
+
+          const Details::Utf8Sequence sequence = Details::DecodeUtf8(data + position, data + size);
+
+          if ( not sequence.Valid )
+          {
+            return position;
+          }
+
+          position += sequence.Length;
+        }
+
+        return size;
+      }
+
+#if defined(CXX_ALGORITHMS_UTF8_SSSE3)
+      // Validación por búsqueda en tablas de J. Keiser y D. Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte" (2021).
+      // Cada par de unidades consecutivas se clasifica con 3 tablas de 16 entradas indexadas por nibble: el AND de las 3
+      // consultas es distinto de 0 solo si el par es un error. Las secuencias de 3 y 4 unidades se verifican aparte.
+      constexpr uint8_t TooShort     = 1 << 0; // 11______ 0_______ ó 11______ 11______
+      constexpr uint8_t TooLong      = 1 << 1; // 0_______ 10______
+      constexpr uint8_t Overlong3    = 1 << 2; // 11100000 100_____
+      constexpr uint8_t TooLarge     = 1 << 3; // 11110100 1001____ ó 11110100 101_____ ó 11110101+ 10______
+      constexpr uint8_t Surrogate    = 1 << 4; // 11101101 101_____
+      constexpr uint8_t Overlong2    = 1 << 5; // 1100000_ 10______
+      constexpr uint8_t TooLarge1000 = 1 << 6; // 11110101+ 1000____
+      constexpr uint8_t Overlong4    = 1 << 6; // 11110000 1000____
+      constexpr uint8_t TwoContinues = 1 << 7; // 10______ 10______
+      constexpr uint8_t Carry        = TooShort | TooLong | TwoContinues;
+
+      alignas(16) constexpr uint8_t FirstByteHigh[16] = {
+        TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong, TooLong,
+        TwoContinues, TwoContinues, TwoContinues, TwoContinues,
+        TooShort | Overlong2,
+        TooShort,
+        TooShort | Overlong3 | Surrogate,
+        TooShort | TooLarge | TooLarge1000 | Overlong4,
+      };
+
+      alignas(16) constexpr uint8_t FirstByteLow[16] = {
+        Carry | Overlong3 | Overlong2 | Overlong4,
+        Carry | Overlong2,
+        Carry,
+        Carry,
+        Carry | TooLarge,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000 | Surrogate,
+        Carry | TooLarge | TooLarge1000,
+        Carry | TooLarge | TooLarge1000,
+      };
+
+      alignas(16) constexpr uint8_t SecondByteHigh[16] = {
+        TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort, TooShort,
+        TooLong | Overlong2 | TwoContinues | Overlong3 | TooLarge1000 | Overlong4,
+        TooLong | Overlong2 | TwoContinues | Overlong3 | TooLarge,
+        TooLong | Overlong2 | TwoContinues | Surrogate | TooLarge,
+        TooLong | Overlong2 | TwoContinues | Surrogate | TooLarge,
+        TooShort, TooShort, TooShort, TooShort,
+      };
+
+      // Valor máximo de las 3 últimas unidades de un bloque que no inician una secuencia que continúa en el siguiente bloque.
+      alignas(16) constexpr uint8_t IncompleteLimit[16] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF };
+
+      [[nodiscard]] bool HasSsse3() noexcept
+      {
+# if defined(__SSSE3__)
+        return true;
+# elif defined(__GNUC__)
+        return __builtin_cpu_supports("ssse3");
+# else
+        int32_t information[4]{};
+        __cpuid(information, 1);
+        return (information[2] & (1 << 9)) != 0;
+# endif
+      }
+
+      [[nodiscard]] CXX_TARGET_SSSE3 inline __m128i Lookup(const uint8_t (&table)[16], const __m128i nibbles) noexcept
+      {
+        return _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(table)), nibbles);
+      }
+
+      /**
+       * @brief Errores de los 16 bytes de input, usando los últimos bytes de previous como contexto.
+       */
+      [[nodiscard]] CXX_TARGET_SSSE3 inline __m128i CheckUtf8(const __m128i input, const __m128i previous) noexcept
+      {
+        const __m128i low_nibble = _mm_set1_epi8(0x0F);
+
+        const __m128i previous1 = _mm_alignr_epi8(input, previous, 15);
+        const __m128i previous2 = _mm_alignr_epi8(input, previous, 14);
+        const __m128i previous3 = _mm_alignr_epi8(input, previous, 13);
+
+        const __m128i first_high  = Lookup(FirstByteHigh, _mm_and_si128(_mm_srli_epi16(previous1, 4), low_nibble));
+        const __m128i first_low   = Lookup(FirstByteLow, _mm_and_si128(previous1, low_nibble));
+        const __m128i second_high = Lookup(SecondByteHigh, _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble));
+
+        const __m128i special_cases = _mm_and_si128(_mm_and_si128(first_high, first_low), second_high);
+
+        // Las unidades 2 posiciones después de un inicio de 3 ó 4 unidades, y 3 posiciones después de uno de 4, deben ser continuaciones.
+        const __m128i third_byte  = _mm_subs_epu8(previous2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+        const __m128i fourth_byte = _mm_subs_epu8(previous3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+        const __m128i must_be_23  = _mm_and_si128(_mm_or_si128(third_byte, fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+        return _mm_xor_si128(must_be_23, special_cases);
+      }
+
+      [[nodiscard]] CXX_TARGET_SSSE3 size_t FindInvalidUtf8Ssse3(const unsigned char* data, const size_t size) noexcept
+      {
+        const __m128i zero             = _mm_setzero_si128();
+        const __m128i incomplete_limit = _mm_load_si128(reinterpret_cast<const __m128i*>(IncompleteLimit));
+
+        __m128i previous   = zero;
+        __m128i incomplete = zero;
+        size_t  offset     = 0;
+
+        for ( ; size - offset >= Utf8BlockSize; offset += Utf8BlockSize )
+        {
+          const __m128i input0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset));
+          const __m128i input1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset + 16));
+          const __m128i input2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset + 32));
+          const __m128i input3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + offset + 48));
+
+          __m128i error;
+
+          if ( _mm_movemask_epi8(_mm_or_si128(_mm_or_si128(input0, input1), _mm_or_si128(input2, input3))) == 0 )
+          {
+            // Bloque ASCII: solo es un error si el bloque anterior terminó con una secuencia incompleta.
+            error      = incomplete;
+            incomplete = zero;
+          }
+          else
+          {
+            error = CheckUtf8(input0, previous);
+            error = _mm_or_si128(error, CheckUtf8(input1, input0));
+            error = _mm_or_si128(error, CheckUtf8(input2, input1));
+            error = _mm_or_si128(error, CheckUtf8(input3, input2));
+
+            incomplete = _mm_subs_epu8(input3, incomplete_limit);
+          }
+
+          previous = input3;
+
+          if ( _mm_movemask_epi8(_mm_cmpeq_epi8(error, zero)) != 0xFFFF )
+          {
+            break;
+          }
+        }
+
+        // Desde el bloque con error, ó desde el resto que no completa un bloque, la posición exacta se obtiene con el recorrido escalar.
+        return FindInvalidUtf8Scalar(data, Utf8SequenceStart(data, offset), size);
+      }
+#endif
+    } // namespace
+
+    namespace Details
+    {
+      [[nodiscard]] size_t FindInvalidUtf8(const unsigned char* data, size_t size) noexcept
+      {
+#if defined(CXX_ALGORITHMS_UTF8_SSSE3)
+        static const bool has_ssse3 = HasSsse3();
+
+        if ( has_ssse3 )
+        {
+          return FindInvalidUtf8Ssse3(data, size);
+        }
+#endif
+
+        return FindInvalidUtf8Scalar(data, 0, size);
+      }
+    } // namespace Details
+
+    namespace
+    {
+      /**
+       * @brief Recorrido de 8 en 8 bytes (SWAR) desde offset: el primer byte distinto es el primer byte distinto de 0 del XOR.
+       */
+      [[nodiscard]] size_t MismatchBytesScalar(const unsigned char* left, const unsigned char* right, size_t offset, const size_t size) noexcept
+      {
+        if constexpr ( std::endian::native == std::endian::little )
+        {
+          for ( ; size - offset >= 8; offset += 8 )
+          {
+            uint64_t left_values  = 0;
+            uint64_t right_values = 0;
+            std::memcpy(&left_values, left + offset, 8);
+            std::memcpy(&right_values, right + offset, 8);
+
+            if ( const uint64_t difference = left_values ^ right_values; difference != 0 )
+            {
+              return offset + static_cast<size_t>(std::countr_zero(difference)) / 8;
+            }
+          }
+        }
+
+        for ( ; offset < size; ++offset )
+        {
+          if ( left[offset] != right[offset] )
+          {
+            return offset;
+          }
+        }
+
+        return size;
+      }
+
+#if defined(CXX_ALGORITHMS_AVX2)
+      [[nodiscard]] bool HasAvx2() noexcept
+      {
+# if defined(__AVX2__)
+        return true;
+# elif defined(__GNUC__)
+        return __builtin_cpu_supports("avx2");
+# else
+        // AVX2 requiere que el sistema operativo guarde los registros YMM (OSXSAVE y XCR0).
+        int32_t information[4]{};
+        __cpuid(information, 1);
+
+        if ( (information[2] & (1 << 27)) == 0 or (_xgetbv(0) & 0x6) != 0x6 )
+        {
+          return false;
+        }
+
+        __cpuidex(information, 7, 0);
+        return (information[1] & (1 << 5)) != 0;
+# endif
+      }
+
+      [[nodiscard]] CXX_TARGET_AVX2 size_t MismatchBytesAvx2(const unsigned char* left, const unsigned char* right, const size_t size) noexcept
+      {
+        size_t offset = 0;
+
+        for ( ; size - offset >= 32; offset += 32 )
+        {
+          const __m256i left_values  = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(left + offset));
+          const __m256i right_values = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right + offset));
+          const auto    equal_mask   = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left_values, right_values)));
+
+          if ( equal_mask != 0xFFFFFFFF )
+          {
+            return offset + static_cast<size_t>(std::countr_one(equal_mask));
+          }
+        }
+
+        return MismatchBytesScalar(left, right, offset, size);
+      }
+#endif
+
+      [[nodiscard]] size_t MismatchBytesSse2(const unsigned char* left, const unsigned char* right, const size_t size) noexcept
+      {
+        size_t offset = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        for ( ; size - offset >= 16; offset += 16 )
+        {
+          const __m128i left_values  = _mm_loadu_si128(reinterpret_cast<const __m128i*>(left + offset));
+          const __m128i right_values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(right + offset));
+          const auto    equal_mask   = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(left_values, right_values)));
+
+          if ( equal_mask != 0xFFFF )
+          {
+            return offset + static_cast<size_t>(std::countr_one(equal_mask));
+          }
+        }
+#endif
+
+        return MismatchBytesScalar(left, right, offset, size);
+      }
+    } // namespace
+
+    namespace Details
+    {
+      [[nodiscard]] size_t MismatchBytes(const void* left, const void* right, const size_t size) noexcept
+      {
+        const auto* left_bytes  = static_cast<const unsigned char*>(left);
+        const auto* right_bytes = static_cast<const unsigned char*>(right);
+
+        // Las cadenas cortas (claves, encabezados) no pagan la selección del kernel.
+        if ( size < 32 )
+        {
+          return MismatchBytesScalar(left_bytes, right_bytes, 0, size);
+        }
+
+#if defined(CXX_ALGORITHMS_AVX2)
+        static const bool has_avx2 = HasAvx2();
+
+        if ( has_avx2 )
+        {
+          return MismatchBytesAvx2(left_bytes, right_bytes, size);
+        }
+#endif
+
+        return MismatchBytesSse2(left_bytes, right_bytes, size);
+      }
+    } // namespace Details
+
+    namespace
+    {
+      /**
+       * @brief Constantes de wyhash (dominio público, Wang Yi).
+       */
+      constexpr std::array<uint64_t, 4> HashSecret{ 0xA0761D6478BD642F, 0xE7037ED1A0B428DB, 0x8EBC6AF09C88C6E3, 0x589965CC75374CC3 };
+
+      /**
+       * @brief Producto de 64 x 64 bits, en low queda la mitad baja del resultado y en high la mitad alta.
+       */
+      void MultiplyWide(uint64_t& low, uint64_t& high) noexcept
+      {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 uint128_t;
+
+        const uint128_t product = static_cast<uint128_t>(low) * high;
+        low                     = static_cast<uint64_t>(product);
+        high                    = static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        low = _umul128(low, high, &high);
+#else
+        const uint64_t low_low   = (low & 0xFFFFFFFF) * (high & 0xFFFFFFFF);
+        const uint64_t high_low  = (low >> 32) * (high & 0xFFFFFFFF);
+        const uint64_t low_high  = (low & 0xFFFFFFFF) * (high >> 32);
+        const uint64_t high_high = (low >> 32) * (high >> 32);
+        const uint64_t cross     = (low_low >> 32) + (high_low & 0xFFFFFFFF) + low_high;
+
+        high = high_high + (high_low >> 32) + (cross >> 32);
+        low  = (cross << 32) | (low_low & 0xFFFFFFFF);
+#endif
+      }
+
+      [[nodiscard]] uint64_t MultiplyMix(uint64_t left, uint64_t right) noexcept
+      {
+        MultiplyWide(left, right);
+        return left ^ right;
+      }
+
+      /**
+       * @brief Lectura little-endian sin requisitos de alineación, el hash es el mismo en todas las plataformas.
+       */
+      template <typename Integer>
+      [[nodiscard]] uint64_t ReadLittleEndian(const unsigned char* data) noexcept
+      {
+        Integer value = 0;
+        std::memcpy(&value, data, sizeof(Integer));
+
+        if constexpr ( std::endian::native == std::endian::big )
+        {
+          value = std::byteswap(value);
+        }
+
+        return value;
+      }
+
+      [[nodiscard]] uint64_t HashSeed(const uint64_t seed) noexcept
+      {
+        return seed ^ MultiplyMix(seed ^ HashSecret[0], HashSecret[1]);
+      }
+
+      [[nodiscard]] uint64_t HashFinal(uint64_t first, uint64_t second, const size_t size, const uint64_t seed) noexcept
+      {
+        first  ^= HashSecret[1];
+        second ^= seed;
+        MultiplyWide(first, second);
+
+        return MultiplyMix(first ^ HashSecret[0] ^ size, second ^ HashSecret[1]);
+      }
+
+      /**
+       * @brief Hash de las claves de hasta 16 bytes, se leen con 2 lecturas que se solapan sin recorrer los bytes uno por uno.
+       */
+      [[nodiscard]] uint64_t HashShort(const unsigned char* bytes, const size_t size, const uint64_t seed) noexcept
+      {
+        uint64_t first  = 0;
+        uint64_t second = 0;
+
+        if ( size >= 4 )
+        {
+          const size_t middle = (size >> 3) << 2;
+
+          first  = (ReadLittleEndian<uint32_t>(bytes) << 32) | ReadLittleEndian<uint32_t>(bytes + middle);
+          second = (ReadLittleEndian<uint32_t>(bytes + size - 4) << 32) | ReadLittleEndian<uint32_t>(bytes + size - 4 - middle);
+        }
+        else if ( size > 0 )
+        {
+          first = (static_cast<uint64_t>(bytes[0]) << 16) | (static_cast<uint64_t>(bytes[size >> 1]) << 8) | bytes[size - 1];
+        }
+
+        return HashFinal(first, second, size, seed);
+      }
+
+      /**
+       * @brief Procesa un bloque de 48 bytes en las 3 cadenas de productos.
+       */
+      void HashBlock(const unsigned char* bytes, std::array<uint64_t, 3>& seeds) noexcept
+      {
+        seeds[0] = MultiplyMix(ReadLittleEndian<uint64_t>(bytes) ^ HashSecret[1], ReadLittleEndian<uint64_t>(bytes + 8) ^ seeds[0]);
+        seeds[1] = MultiplyMix(ReadLittleEndian<uint64_t>(bytes + 16) ^ HashSecret[2], ReadLittleEndian<uint64_t>(bytes + 24) ^ seeds[1]);
+        seeds[2] = MultiplyMix(ReadLittleEndian<uint64_t>(bytes + 32) ^ HashSecret[3], ReadLittleEndian<uint64_t>(bytes + 40) ^ seeds[2]);
+      }
+
+      /**
+       * @brief Últimos [1, 48] bytes de una clave de más de 16 bytes. La lectura final toma los 16 bytes anteriores a
+       *        bytes + remaining, que pueden pertenecer al bloque anterior.
+       */
+      [[nodiscard]] uint64_t HashTail(const unsigned char* bytes, size_t remaining, const size_t size, uint64_t seed) noexcept
+      {
+        for ( ; remaining > 16; remaining -= 16, bytes += 16 )
+        {
+          seed = MultiplyMix(ReadLittleEndian<uint64_t>(bytes) ^ HashSecret[1], ReadLittleEndian<uint64_t>(bytes + 8) ^ seed);
+        }
+
+        return HashFinal(ReadLittleEndian<uint64_t>(bytes + remaining - 16), ReadLittleEndian<uint64_t>(bytes + remaining - 8), size, seed);
+      }
+    } // namespace
+
+    namespace Details
+    {
+      [[nodiscard]] uint64_t HashBytes(const void* data, const size_t size, uint64_t seed) noexcept
+      {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+
+        seed = HashSeed(seed);
+
+        if ( size <= 16 )
+        {
+          return HashShort(bytes, size, seed);
+        }
+
+        size_t remaining = size;
+
+        if ( remaining > 48 )
+        {
+          // 3 cadenas de productos independientes para que el procesador las ejecute en paralelo.
+          std::array<uint64_t, 3> seeds{ seed, seed, seed };
+
+          do
+          {
+            HashBlock(bytes, seeds);
+            bytes     += 48;
+            remaining -= 48;
+          } while ( remaining > 48 );
+
+          seed = seeds[0] ^ seeds[1] ^ seeds[2];
+        }
+
+        return HashTail(bytes, remaining, size, seed);
+      }
+
+      HashStream::HashStream(const uint64_t seed) noexcept
+        : m_Seed{ HashSeed(seed) }
+      {
+        m_Seeds.fill(m_Seed);
+      }
+
+      void HashStream::Append(const void* data, size_t size) noexcept
+      {
+        const auto* bytes = static_cast<const unsigned char*>(data);
+
+        m_Size += size;
+
+        while ( size > 0 )
+        {
+          // Un bloque completo solo se procesa cuando le siguen más bytes, igual que el ciclo "remaining > 48" de HashBytes.
+          if ( m_Pending == BlockSize )
+          {
+            HashBlock(m_Buffer.data() + HistorySize, m_Seeds);
+            std::memcpy(m_Buffer.data(), m_Buffer.data() + BlockSize, HistorySize);
+            m_Pending = 0;
+          }
+
+          const size_t count = std::min(size, BlockSize - m_Pending);
+          std::memcpy(m_Buffer.data() + HistorySize + m_Pending, bytes, count);
+
+          m_Pending += count;
+          bytes     += count;
+          size      -= count;
+        }
+      }
+
+      [[nodiscard]] uint64_t HashStream::Finish() const noexcept
+      {
+        const unsigned char* const pending = m_Buffer.data() + HistorySize;
+
+        if ( m_Size <= 16 )
+        {
+          return HashShort(pending, m_Size, m_Seed);
+        }
+
+        // Sin bloques procesados HashBytes no usa las 3 cadenas; con ellos los bytes anteriores a pending están en el buffer.
+        const uint64_t seed = m_Size > BlockSize ? m_Seeds[0] ^ m_Seeds[1] ^ m_Seeds[2] : m_Seed;
+        return HashTail(pending, m_Pending, m_Size, seed);
+      }
+    } // namespace Details
+
+    namespace
+    {
+      /**
+       * @brief Indica si la distancia ya no puede ser menor ó igual que maximum_distance: cada byte restante del texto puede
+       *        reducir la distancia de la última fila como máximo en 1.
+       */
+      [[nodiscard]] bool ExceedsEditDistance(const size_t score, const size_t remaining, const size_t maximum_distance) noexcept
+      {
+        return score > remaining and score - remaining > maximum_distance;
+      }
+
+      /**
+       * @brief Myers con el patrón en una sola palabra de 64 bits: vp y vn codifican las diferencias verticales +1 y -1 de la columna.
+       */
+      [[nodiscard]] size_t EditDistanceWord(const unsigned char* pattern, const size_t pattern_size, const unsigned char* text, const size_t text_size, const size_t maximum_distance) noexcept
+      {
+        std::array<uint64_t, 256> matches{};
+
+        for ( size_t index = 0; index < pattern_size; ++index )
+        {
+          matches[pattern[index]] |= uint64_t{ 1 } << index;
+        }
+
+        const uint64_t last = uint64_t{ 1 } << (pattern_size - 1);
+
+        uint64_t vp    = ~uint64_t{ 0 };
+        uint64_t vn    = 0;
+        size_t   score = pattern_size;
+
+        for ( size_t index = 0; index < text_size; ++index )
+        {
+          const uint64_t eq = matches[text[index]];
+          const uint64_t xv = eq | vn;
+          const uint64_t xh = (((eq & vp) + vp) ^ vp) | eq;
+
+          uint64_t hp = vn | ~(xh | vp);
+          uint64_t hn = vp & xh;
+
+          if ( hp & last )
+          {
+            ++score;
+          }
+          else if ( hn & last )
+          {
+            --score;
+          }
+
+          if ( ExceedsEditDistance(score, text_size - index - 1, maximum_distance) )
+          {
+            return maximum_distance + 1;
+          }
+
+          // La primera fila de la distancia global crece en 1 por columna: la diferencia horizontal que entra es +1.
+          hp = (hp << 1) | 1;
+          hn = hn << 1;
+          vp = hn | ~(xv | hp);
+          vn = hp & xv;
+        }
+
+        return score;
+      }
+
+      /**
+       * @brief Myers por bloques de 64 filas: cada bloque recibe la diferencia horizontal (+1, 0, -1) del bloque anterior.
+       */
+      [[nodiscard]] size_t EditDistanceBlocks(const unsigned char* pattern, const size_t pattern_size, const unsigned char* text, const size_t text_size, const size_t maximum_distance)
+      {
+        const size_t block_count = (pattern_size + 63) / 64;
+
+        // matches[character * block_count + block] tiene un bit por cada posición del bloque donde el patrón es character.
+        std::vector<uint64_t> matches(256 * block_count);
+
+        for ( size_t index = 0; index < pattern_size; ++index )
+        {
+          matches[pattern[index] * block_count + index / 64] |= uint64_t{ 1 } << (index % 64);
+        }
+
+        std::vector<uint64_t> vp(block_count, ~uint64_t{ 0 });
+        std::vector<uint64_t> vn(block_count, 0);
+
+        const uint64_t last  = uint64_t{ 1 } << ((pattern_size - 1) % 64);
+        size_t         score = pattern_size;
+
+        for ( size_t index = 0; index < text_size; ++index )
+        {
+          const uint64_t* column = matches.data() + text[index] * block_count;
+          int32_t         carry  = 1;
+
+          for ( size_t block = 0; block < block_count; ++block )
+          {
+            uint64_t       eq = column[block];
+            const uint64_t xv = eq | vn[block];
+
+            if ( carry < 0 )
+            {
+              eq |= 1;
+            }
+
+            const uint64_t xh   = (((eq & vp[block]) + vp[block]) ^ vp[block]) | eq;
+            uint64_t       hp   = vn[block] | ~(xh | vp[block]);
+            uint64_t       hn   = vp[block] & xh;
+            const uint64_t high = block + 1 == block_count ? last : uint64_t{ 1 } << 63;
+
+            const int32_t carry_out = (hp & high) ? 1 : (hn & high) ? -1 : 0;
+
+            hp <<= 1;
+            hn <<= 1;
+
+            if ( carry < 0 )
+            {
+              hn |= 1;
+            }
+            else if ( carry > 0 )
+            {
+              hp |= 1;
+            }
+
+            vp[block] = hn | ~(xv | hp);
+            vn[block] = hp & xv;
+            carry     = carry_out;
+          }
+
+          score = carry > 0 ? score + 1 : carry < 0 ? score - 1 : score;
+
+          if ( ExceedsEditDistance(score, text_size - index - 1, maximum_distance) )
+          {
+            return maximum_distance + 1;
+          }
+        }
+
+        return score;
+      }
+    } // namespace
+
+    namespace Details
+    {
+      [[nodiscard]] size_t EditDistanceBytes(const unsigned char* left, size_t left_size, const unsigned char* right, size_t right_size, const size_t maximum_distance)
+      {
+        // El patrón codificado en bits es la secuencia más corta.
+        if ( left_size > right_size )
+        {
+          std::swap(left, right);
+          std::swap(left_size, right_size);
+        }
+
+        if ( right_size - left_size > maximum_distance )
+        {
+          return maximum_distance + 1;
+        }
+
+        // El prefijo y el sufijo comunes no cambian la distancia; en los duplicados aproximados suelen ser casi toda la cadena.
+        const size_t prefix = MismatchBytes(left, right, left_size);
+
+        left += prefix;
+        right += prefix;
+        left_size -= prefix;
+        right_size -= prefix;
+
+        while ( left_size != 0 and left[left_size - 1] == right[right_size - 1] )
+        {
+          --left_size;
+          --right_size;
+        }
+
+        if ( left_size == 0 )
+        {
+          return right_size;
+        }
+
+        if ( left_size <= 64 )
+        {
+          return EditDistanceWord(left, left_size, right, right_size, maximum_distance);
+        }
+
+        return EditDistanceBlocks(left, left_size, right, right_size, maximum_distance);
+      }
+    } // namespace Details
+
+    namespace
+    {
+      /**
+       * @brief Conversión de caso de char obtenida una sola vez del facet std::ctype<char> de la configuración regional global.
+       */
+      struct CharacterCaseTables
+      {
+          std::locale           Locale;
+          std::array<char, 256> Upper;
+          std::array<char, 256> Lower;
+
+          /**
+           * @brief Indica si el facet solo convierte las letras ASCII, como la configuración "C" y las configuraciones UTF-8.
+           */
+          bool AsciiOnly;
+      };
+
+      [[nodiscard]] const CharacterCaseTables& CaseTables()
+      {
+        static const CharacterCaseTables tables = []
+        {
+          CharacterCaseTables result{ std::locale{}, {}, {}, true };
+          const auto&         facet = std::use_facet<std::ctype<char>>(result.Locale);
+
+          for ( size_t index = 0; index < result.Upper.size(); ++index )
+          {
+            const auto character = static_cast<char>(index);
+            result.Upper[index]  = facet.toupper(character);
+            result.Lower[index]  = facet.tolower(character);
+
+            const bool is_lower = index >= 'a' and index <= 'z';
+            const bool is_upper = index >= 'A' and index <= 'Z';
+
+            result.AsciiOnly = result.AsciiOnly and result.Upper[index] == static_cast<char>(is_lower ? index - 32 : index) and
+                               result.Lower[index] == static_cast<char>(is_upper ? index + 32 : index);
+          }
+
+          return result;
+        }();
+
+        return tables;
+      }
+
+      /**
+       * @brief Facet std::ctype<wchar_t> de la configuración regional global, obtenido una sola vez.
+       */
+      struct WideCaseFacet
+      {
+          std::locale                 Locale;
+          const std::ctype<wchar_t>*  Facet;
+
+          /**
+           * @brief Indica si el facet convierte las letras ASCII como la configuración "C".
+           */
+          bool AsciiIsClassic;
+      };
+
+      [[nodiscard]] const WideCaseFacet& WideFacet()
+      {
+        static const WideCaseFacet facet = []
+        {
+          WideCaseFacet result{ std::locale{}, nullptr, true };
+          result.Facet = &std::use_facet<std::ctype<wchar_t>>(result.Locale);
+
+          for ( wchar_t character = 0; character < 0x80; ++character )
+          {
+            const bool is_lower = character >= L'a' and character <= L'z';
+            const bool is_upper = character >= L'A' and character <= L'Z';
+
+            result.AsciiIsClassic = result.AsciiIsClassic and result.Facet->toupper(character) == (is_lower ? character - 32 : character) and
+                                    result.Facet->tolower(character) == (is_upper ? character + 32 : character);
+          }
+
+          return result;
+        }();
+
+        return facet;
+      }
+
+#if defined(__SSE2__) || defined(_M_X64)
+      /**
+       * @brief Cambia el caso de las letras ASCII de 16 bytes: first es 'a' para convertir a mayúsculas y 'A' para minúsculas.
+       *
+       *  Restando first + 128, las letras del rango [first, first + 26) quedan en [-128, -102): una sola comparación con signo.
+       */
+      [[nodiscard]] inline __m128i ConvertAsciiCase16(const __m128i values, const char first) noexcept
+      {
+        const __m128i is_letter = _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(-128 + 26)), _mm_sub_epi8(values, _mm_set1_epi8(static_cast<char>(first + 128))));
+        return _mm_xor_si128(values, _mm_and_si128(is_letter, _mm_set1_epi8(0x20)));
+      }
+#endif
+
+      /**
+       * @brief Cambia el caso de las letras ASCII de 8 bytes (SWAR): first es 'a' para convertir a mayúsculas y 'A' para minúsculas.
+       */
+      [[nodiscard]] inline uint64_t ConvertAsciiCase8(const uint64_t values, const char first) noexcept
+      {
+        constexpr uint64_t ones      = 0x0101010101010101;
+        constexpr uint64_t high_bits = 0x8080808080808080;
+
+        // Con los 7 bits bajos de cada byte las sumas no se propagan al byte vecino; los bytes no ASCII se descartan con ~values.
+        const uint64_t heptets   = values & ~high_bits;
+        const uint64_t is_letter = (heptets + ones * static_cast<uint64_t>(0x80 - first)) & ~(heptets + ones * static_cast<uint64_t>(0x80 - first - 26)) & ~values & high_bits;
+
+        return values ^ (is_letter >> 2);
+      }
+
+      void ConvertAsciiCaseSimd(const char* input, char* output, const size_t size, const Details::LetterCase letter_case) noexcept
+      {
+        const char first  = letter_case == Details::LetterCase::Upper ? 'a' : 'A';
+        size_t     offset = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        for ( ; size - offset >= 16; offset += 16 )
+        {
+          const __m128i values = _mm_loadu_si128(reinterpret_cast<const __m128i*>(input + offset));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(output + offset), ConvertAsciiCase16(values, first));
+        }
+#endif
+
+        // Resto de 8 en 8 bytes (SWAR): los encabezados HTTP suelen ser más cortos que un bloque de 16 bytes.
+        for ( ; size - offset >= 8; offset += 8 )
+        {
+          uint64_t values = 0;
+          std::memcpy(&values, input + offset, 8);
+          values = ConvertAsciiCase8(values, first);
+          std::memcpy(output + offset, &values, 8);
+        }
+
+        Details::ConvertAsciiCase(input + offset, output + offset, size - offset, letter_case);
+      }
+    } // namespace
+
+    namespace Details
+    {
+      void ConvertCase(const char* input, char* output, const size_t size, const LetterCase letter_case)
+      {
+        const CharacterCaseTables& tables = CaseTables();
+
+        if ( tables.AsciiOnly )
+        {
+          ConvertAsciiCaseSimd(input, output, size, letter_case);
+          return;
+        }
+
+        const std::array<char, 256>& table = letter_case == LetterCase::Upper ? tables.Upper : tables.Lower;
+
+        for ( size_t index = 0; index < size; ++index )
+        {
+          output[index] = table[static_cast<unsigned char>(input[index])];
+        }
+      }
+
+      void ConvertCase(const wchar_t* input, wchar_t* output, const size_t size, const LetterCase letter_case)
+      {
+        const WideCaseFacet& wide = WideFacet();
+
+        if ( not wide.AsciiIsClassic )
+        {
+          if ( input != output )
+          {
+            std::copy_n(input, size, output);
+          }
+
+          if ( letter_case == LetterCase::Upper )
+          {
+            wide.Facet->toupper(output, output + size);
+          }
+          else
+          {
+            wide.Facet->tolower(output, output + size);
+          }
+
+          return;
+        }
+
+        for ( size_t index = 0; index < size; ++index )
+        {
+          const wchar_t unit = input[index];
+
+          if ( static_cast<uint32_t>(unit) < 0x80 )
+          {
+            ConvertAsciiCase(&unit, output + index, 1, letter_case);
+          }
+          else
+          {
+            output[index] = letter_case == LetterCase::Upper ? wide.Facet->toupper(unit) : wide.Facet->tolower(unit);
+          }
+        }
+      }
+
+      void ConvertCase(const char* input, char* output, const size_t size, const LetterCase letter_case, const std::locale& locale)
+      {
+        if ( locale == CaseTables().Locale )
+        {
+          ConvertCase(input, output, size, letter_case);
+          return;
+        }
+
+        const auto& facet = std::use_facet<std::ctype<char>>(locale);
+
+        if ( input != output )
+        {
+          std::copy_n(input, size, output);
+        }
+
+        if ( letter_case == LetterCase::Upper )
+        {
+          facet.toupper(output, output + size);
+        }
+        else
+        {
+          facet.tolower(output, output + size);
+        }
+      }
+
+      void ConvertCase(const wchar_t* input, wchar_t* output, const size_t size, const LetterCase letter_case, const std::locale& locale)
+      {
+        if ( locale == WideFacet().Locale )
+        {
+          ConvertCase(input, output, size, letter_case);
+          return;
+        }
+
+        const auto& facet = std::use_facet<std::ctype<wchar_t>>(locale);
+
+        if ( input != output )
+        {
+          std::copy_n(input, size, output);
+        }
+
+        if ( letter_case == LetterCase::Upper )
+        {
+          facet.toupper(output, output + size);
+        }
+        else
+        {
+          facet.tolower(output, output + size);
+        }
+      }
+
+      [[nodiscard]] char FoldCase(const char character)
+      {
+        return CaseTables().Lower[static_cast<unsigned char>(character)];
+      }
+
+      [[nodiscard]] wchar_t FoldCase(const wchar_t character)
+      {
+        const WideCaseFacet& wide = WideFacet();
+
+        if ( wide.AsciiIsClassic and static_cast<uint32_t>(character) < 0x80 )
+        {
+          return FoldCase<wchar_t>(character);
+        }
+
+        return wide.Facet->tolower(character);
+      }
+
+      [[nodiscard]] size_t MismatchIgnoreCase(const char* left, const char* right, const size_t size)
+      {
+        const CharacterCaseTables& tables = CaseTables();
+
+        size_t offset = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        if ( tables.AsciiOnly )
+        {
+          for ( ; size - offset >= 16; offset += 16 )
+          {
+            const __m128i left_values  = ConvertAsciiCase16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left + offset)), 'A');
+            const __m128i right_values = ConvertAsciiCase16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(right + offset)), 'A');
+            const auto    equal_mask   = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(left_values, right_values)));
+
+            if ( equal_mask != 0xFFFF )
+            {
+              return offset + static_cast<size_t>(std::countr_one(equal_mask));
+            }
+          }
+        }
+#endif
+
+        if constexpr ( std::endian::native == std::endian::little )
+        {
+          if ( tables.AsciiOnly )
+          {
+            for ( ; size - offset >= 8; offset += 8 )
+            {
+              uint64_t left_values  = 0;
+              uint64_t right_values = 0;
+              std::memcpy(&left_values, left + offset, 8);
+              std::memcpy(&right_values, right + offset, 8);
+
+              // El primer byte distinto es el byte menos significativo del XOR distinto de 0.
+              const uint64_t difference = ConvertAsciiCase8(left_values, 'A') ^ ConvertAsciiCase8(right_values, 'A');
+
+              if ( difference != 0 )
+              {
+                return offset + static_cast<size_t>(std::countr_zero(difference)) / 8;
+              }
+            }
+          }
+        }
+
+        for ( ; offset < size; ++offset )
+        {
+          if ( tables.Lower[static_cast<unsigned char>(left[offset])] != tables.Lower[static_cast<unsigned char>(right[offset])] )
+          {
+            return offset;
+          }
+        }
+
+        return size;
+      }
+
+      [[nodiscard]] const char* SearchIgnoreCase(const char* first, const char* last, const char* pattern, const size_t pattern_size)
+      {
+        if ( pattern_size == 0 )
+        {
+          return first;
+        }
+
+        const auto size = static_cast<size_t>(last - first);
+
+        if ( size < pattern_size )
+        {
+          return last;
+        }
+
+        const CharacterCaseTables& tables = CaseTables();
+
+        const char   head      = tables.Lower[static_cast<unsigned char>(pattern[0])];
+        const char   tail      = tables.Lower[static_cast<unsigned char>(pattern[pattern_size - 1])];
+        const size_t positions = size - pattern_size + 1;
+
+        size_t position = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        if ( tables.AsciiOnly )
+        {
+          // W. Muła, "SIMD-friendly algorithms for substring searching": se comparan a la vez el primer y el último caracter del
+          // Patrón con 16 posiciones candidatas, y el Patrón completo solo se verifica donde ambos coinciden.
+          const __m128i heads = _mm_set1_epi8(head);
+          const __m128i tails = _mm_set1_epi8(tail);
+
+          for ( ; positions - position >= 16; position += 16 )
+          {
+            const __m128i first_values = ConvertAsciiCase16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + position)), 'A');
+            const __m128i last_values  = ConvertAsciiCase16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + position + pattern_size - 1)), 'A');
+
+            auto candidates = static_cast<uint32_t>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_values, heads), _mm_cmpeq_epi8(last_values, tails))));
+
+            for ( ; candidates != 0; candidates &= candidates - 1 )
+            {
+              const char* candidate = first + position + static_cast<size_t>(std::countr_zero(candidates));
+
+              if ( MismatchIgnoreCase(candidate + 1, pattern + 1, pattern_size - 1) == pattern_size - 1 )
+              {
+                return candidate;
+              }
+            }
+          }
+        }
+#endif
+
+        for ( ; position < positions; ++position )
+        {
+          if ( tables.Lower[static_cast<unsigned char>(first[position])] == head and MismatchIgnoreCase(first + position + 1, pattern + 1, pattern_size - 1) == pattern_size - 1 )
+          {
+            return first + position;
+          }
+        }
 
+        return last;
+      }
+    } // namespace Details
+  } // namespace Algorithms::inline V1
 } // namespace Cxx
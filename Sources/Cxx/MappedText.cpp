@@ -0,0 +1,325 @@
+#include "Cxx/MappedText.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#if defined(_WIN32)
+# ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN
+# endif
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# include <windows.h>
+#else
+# include <cerrno>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+namespace Cxx
+{
+  namespace
+  {
+#if defined(_WIN32)
+    [[nodiscard]] std::error_code LastError() noexcept
+    {
+      return std::error_code{ static_cast<int32_t>(::GetLastError()), std::system_category() };
+    }
+
+    struct HandleGuard
+    {
+        HANDLE Handle;
+
+        ~HandleGuard()
+        {
+          if ( Handle != nullptr and Handle != INVALID_HANDLE_VALUE )
+          {
+            ::CloseHandle(Handle);
+          }
+        }
+    };
+#else
+    [[nodiscard]] std::error_code LastError() noexcept
+    {
+      return std::error_code{ errno, std::generic_category() };
+    }
+
+    struct FileDescriptorGuard
+    {
+        int32_t FileDescriptor;
+
+        ~FileDescriptorGuard()
+        {
+          if ( FileDescriptor >= 0 )
+          {
+            ::close(FileDescriptor);
+          }
+        }
+    };
+#endif
+  } // namespace
+
+#if defined(_WIN32)
+  MappedText::MappedText(const std::filesystem::path& path)
+  {
+    const HandleGuard file{ ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+
+    if ( file.Handle == INVALID_HANDLE_VALUE )
+    {
+      throw IOException(LastError());
+    }
+
+    LARGE_INTEGER file_size{};
+
+    if ( not ::GetFileSizeEx(file.Handle, &file_size) )
+    {
+      throw IOException(LastError());
+    }
+
+    SYSTEM_INFO system_info{};
+    ::GetSystemInfo(&system_info);
+
+    const auto size = static_cast<size_type>(file_size.QuadPart);
+
+    if ( size % system_info.dwPageSize != 0 )
+    {
+      // El resto de la última página proyectada se rellena con ceros, por lo que data()[size] es '\0'.
+      const HandleGuard mapping{ ::CreateFileMappingW(file.Handle, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+
+      if ( mapping.Handle == nullptr )
+      {
+        throw IOException(LastError());
+      }
+
+      void* view = ::MapViewOfFile(mapping.Handle, FILE_MAP_READ, 0, 0, 0);
+
+      if ( view == nullptr )
+      {
+        throw IOException(LastError());
+      }
+
+      m_Mapping     = view;
+      m_MappingSize = 0;
+    }
+    else
+    {
+      // No existe una página adicional para el '\0': el archivo se lee en una reserva propia de size + 1 bytes.
+      void* buffer = ::VirtualAlloc(nullptr, size + 1, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+      if ( buffer == nullptr )
+      {
+        throw IOException(LastError());
+      }
+
+      for ( size_type offset = 0; offset < size; )
+      {
+        DWORD read = 0;
+
+        if ( not ::ReadFile(file.Handle, static_cast<char*>(buffer) + offset, static_cast<DWORD>(std::min<size_type>(size - offset, MAXDWORD)), &read, nullptr) or read == 0 )
+        {
+          const std::error_code error_code = read == 0 ? std::make_error_code(std::errc::io_error) : LastError();
+          ::VirtualFree(buffer, 0, MEM_RELEASE);
+          throw IOException(error_code);
+        }
+
+        offset += read;
+      }
+
+      m_Mapping     = buffer;
+      m_MappingSize = size + 1;
+    }
+
+    m_Data = static_cast<const char*>(m_Mapping);
+    m_Size = size;
+  }
+
+  void MappedText::Release() noexcept
+  {
+    if ( m_Mapping == nullptr )
+    {
+      return;
+    }
+
+    // m_MappingSize es 0 para una vista de CreateFileMapping y distinto de 0 para una reserva de VirtualAlloc.
+    if ( m_MappingSize == 0 )
+    {
+      ::UnmapViewOfFile(m_Mapping);
+    }
+    else
+    {
+      ::VirtualFree(m_Mapping, 0, MEM_RELEASE);
+    }
+  }
+
+  bool MappedText::Advise(const Advice) noexcept
+  {
+    return false;
+  }
+#else
+  MappedText::MappedText(const std::filesystem::path& path)
+  {
+    const FileDescriptorGuard file{ ::open(path.c_str(), O_RDONLY | O_CLOEXEC) };
+
+    if ( file.FileDescriptor < 0 )
+    {
+      throw IOException(LastError());
+    }
+
+    struct stat status{};
+
+    if ( ::fstat(file.FileDescriptor, &status) != 0 )
+    {
+      throw IOException(LastError());
+    }
+
+    const auto size      = static_cast<size_type>(status.st_size);
+    const auto page_size = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+
+    // Se reserva al menos un byte más que el archivo redondeado a páginas completas: las páginas que no cubre el archivo
+    // son anónimas y se rellenan con ceros, por lo que data()[size] siempre es '\0'.
+    const size_type mapping_size = (size / page_size + 1) * page_size;
+
+    void* mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if ( mapping == MAP_FAILED )
+    {
+      throw IOException(LastError());
+    }
+
+    if ( size > 0 and ::mmap(mapping, size, PROT_READ, MAP_SHARED | MAP_FIXED, file.FileDescriptor, 0) == MAP_FAILED )
+    {
+      const std::error_code error_code = LastError();
+      ::munmap(mapping, mapping_size);
+      throw IOException(error_code);
+    }
+
+    m_Mapping     = mapping;
+    m_MappingSize = mapping_size;
+    m_Data        = static_cast<const char*>(mapping);
+    m_Size        = size;
+  }
+
+  void MappedText::Release() noexcept
+  {
+    if ( m_Mapping != nullptr )
+    {
+      ::munmap(m_Mapping, m_MappingSize);
+    }
+  }
+
+  bool MappedText::Advise(const Advice advice) noexcept
+  {
+    if ( m_Mapping == nullptr )
+    {
+      return false;
+    }
+
+    int32_t native_advice = MADV_NORMAL;
+
+    switch ( advice )
+    {
+      case Advice::Normal:
+        native_advice = MADV_NORMAL;
+        break;
+
+      case Advice::Sequential:
+        native_advice = MADV_SEQUENTIAL;
+        break;
+
+      case Advice::Random:
+        native_advice = MADV_RANDOM;
+        break;
+
+      case Advice::WillNeed:
+        native_advice = MADV_WILLNEED;
+        break;
+
+      case Advice::HugePages:
+# if defined(MADV_HUGEPAGE)
+        native_advice = MADV_HUGEPAGE;
+        break;
+# else
+        return false;
+# endif
+    }
+
+    return ::madvise(m_Mapping, m_MappingSize, native_advice) == 0;
+  }
+#endif
+
+  MappedText::MappedText(MappedText&& other) noexcept
+    : m_Data{ std::exchange(other.m_Data, "") }
+    , m_Size{ std::exchange(other.m_Size, 0) }
+    , m_Mapping{ std::exchange(other.m_Mapping, nullptr) }
+    , m_MappingSize{ std::exchange(other.m_MappingSize, 0) }
+  {
+  }
+
+  MappedText& MappedText::operator=(MappedText&& other) noexcept
+  {
+    if ( this != &other )
+    {
+      Release();
+
+      m_Data        = std::exchange(other.m_Data, "");
+      m_Size        = std::exchange(other.m_Size, 0);
+      m_Mapping     = std::exchange(other.m_Mapping, nullptr);
+      m_MappingSize = std::exchange(other.m_MappingSize, 0);
+    }
+
+    return *this;
+  }
+
+  MappedText::~MappedText()
+  {
+    Release();
+  }
+
+  [[nodiscard]] MappedText::const_pointer MappedText::data() const noexcept
+  {
+    return m_Data;
+  }
+
+  [[nodiscard]] MappedText::const_pointer MappedText::c_str() const noexcept
+  {
+    return m_Data;
+  }
+
+  [[nodiscard]] MappedText::size_type MappedText::size() const noexcept
+  {
+    return m_Size;
+  }
+
+  [[nodiscard]] bool MappedText::empty() const noexcept
+  {
+    return m_Size == 0;
+  }
+
+  [[nodiscard]] MappedText::const_iterator MappedText::begin() const noexcept
+  {
+    return m_Data;
+  }
+
+  [[nodiscard]] MappedText::const_iterator MappedText::end() const noexcept
+  {
+    return m_Data + m_Size;
+  }
+
+  [[nodiscard]] std::string_view MappedText::AsStringView() const noexcept
+  {
+    return std::string_view{ m_Data, m_Size };
+  }
+
+  [[nodiscard]] ZString<char> MappedText::AsZString() const noexcept
+  {
+    return ZString<char>{ m_Data, m_Size };
+  }
+
+  [[nodiscard]] MappedText::operator std::string_view() const noexcept
+  {
+    return AsStringView();
+  }
+} // namespace Cxx
@@ -0,0 +1,816 @@
+// Mediciones de rendimiento de Cxx::Algorithms.
+//
+// Están deshabilitadas por defecto para no alargar la ejecución de las pruebas, se ejecutan con:
+//    CxxLibrariesTests --gtest_also_run_disabled_tests --gtest_filter=AlgorithmsBenchmarks.*
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Cxx/Algorithms.hpp"
+#include "Cxx/MappedText.hpp"
+#include "TemporaryFile.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using Cxx::Algorithms::CsvIndex;
+using Cxx::Algorithms::Join;
+using Cxx::Algorithms::JoinInto;
+using Cxx::Algorithms::ParallelSplit;
+using Cxx::Algorithms::Split;
+using Cxx::Algorithms::SplitIndex;
+using Cxx::Algorithms::SplitInto;
+using Cxx::Algorithms::SplitAny;
+using Cxx::Algorithms::StreamSplit;
+using Cxx::Algorithms::ThreadCount;
+using Cxx::Algorithms::ToLowerCase;
+using Cxx::Algorithms::ToLowerCaseInPlace;
+using Cxx::Algorithms::WriteChunks;
+using Cxx::Tests::TemporaryFile;
+
+using std::string;
+using std::string_view;
+using std::vector;
+
+using namespace std::string_view_literals;
+
+namespace
+{
+  constexpr size_t BufferSize = 32 * 1024 * 1024;
+  constexpr size_t Iterations = 5;
+
+  /**
+   * @brief Genera un buffer similar a un archivo de logs: líneas de longitud variable separadas por '\n'.
+   */
+  string MakeLogBuffer(const size_t size)
+  {
+    constexpr string_view line = "2023-02-25T10:15:00Z INFO Cxx::Algorithms request=/api/v1/items status=200 elapsed=12ms";
+
+    string buffer;
+    buffer.reserve(size + line.size());
+
+    for ( size_t index = 0; buffer.size() < size; ++index )
+    {
+      buffer.append(line.substr(0, line.size() - index % 48));
+      buffer.push_back('\n');
+    }
+
+    return buffer;
+  }
+
+  /**
+   * @brief Ejecuta "callable" varias veces y muestra el mejor rendimiento obtenido en MB/s.
+   */
+  template <typename Callable>
+  void Measure(const string_view name, const size_t bytes, Callable&& callable)
+  {
+    using Clock = std::chrono::steady_clock;
+
+    auto best = Clock::duration::max();
+
+    for ( size_t iteration = 0; iteration < Iterations; ++iteration )
+    {
+      const auto start = Clock::now();
+      callable();
+      best = std::min(best, Clock::now() - start);
+    }
+
+    const double seconds = std::chrono::duration<double>(best).count();
+    std::printf("%-48.*s %10.2f MB/s\n", static_cast<int32_t>(name.size()), name.data(), static_cast<double>(bytes) / seconds / (1024.0 * 1024.0));
+  }
+} // namespace
+
+TEST(AlgorithmsBenchmarks, DISABLED_SplitSingleCharacter)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  ptrdiff_t pattern_tokens   = 0;
+  ptrdiff_t character_tokens = 0;
+
+  Measure("Split<None>(Text, \"\\n\")", buffer.size(), [&] { pattern_tokens = std::ranges::distance(Split<None>(buffer, "\n")); });
+  Measure("Split<None>(Text, '\\n')", buffer.size(), [&] { character_tokens = std::ranges::distance(Split<None>(buffer, '\n')); });
+
+  EXPECT_EQ(pattern_tokens, character_tokens);
+
+  Measure("Split<RemoveEmptyEntries>(Text, \"\\n\")", buffer.size(), [&] { pattern_tokens = std::ranges::distance(Split<RemoveEmptyEntries>(buffer, "\n")); });
+  Measure("Split<RemoveEmptyEntries>(Text, '\\n')", buffer.size(), [&] { character_tokens = std::ranges::distance(Split<RemoveEmptyEntries>(buffer, '\n')); });
+
+  EXPECT_EQ(pattern_tokens, character_tokens);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_SplitAnyDelimiter)
+{
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  ptrdiff_t chained_tokens = 0;
+  ptrdiff_t any_tokens     = 0;
+
+  Measure("Split('\\n') > Split(' ') > Split('=')", buffer.size(), [&]
+  {
+    chained_tokens = 0;
+
+    for ( const string_view line : Split(buffer, '\n') )
+    {
+      for ( const string_view word : Split(line, ' ') )
+      {
+        chained_tokens += std::ranges::distance(Split(word, '='));
+      }
+    }
+  });
+
+  Measure("SplitAny(Text, \" =\\n\")", buffer.size(), [&] { any_tokens = std::ranges::distance(SplitAny(buffer, " =\n")); });
+
+  EXPECT_EQ(chained_tokens, any_tokens);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_SplitPatternLength)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+  using Cxx::Algorithms::Searchers::HorspoolSearcher;
+  using Cxx::Algorithms::Searchers::SubstringSearcher;
+
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  for ( const string_view pattern : { " request="sv, "elapsed=12ms\n2023"sv, "status=200 elapsed=12ms\n2023-02-25T10:15:00Z INFO"sv } )
+  {
+    std::printf("Pattern length: %zu\n", pattern.size());
+
+    ptrdiff_t ranges_tokens    = 0;
+    ptrdiff_t split_tokens     = 0;
+    ptrdiff_t substring_tokens = 0;
+    ptrdiff_t horspool_tokens  = 0;
+
+    Measure("  std::views::split", buffer.size(), [&] { ranges_tokens = std::ranges::distance(string_view{ buffer } | std::views::split(pattern)); });
+    Measure("  Split(Text, Pattern)", buffer.size(), [&] { split_tokens = std::ranges::distance(Split<None>(buffer, pattern)); });
+    Measure("  Split(Text, SubstringSearcher)", buffer.size(), [&] { substring_tokens = std::ranges::distance(Split<None>(buffer, SubstringSearcher{ pattern })); });
+    Measure("  Split(Text, HorspoolSearcher)", buffer.size(), [&] { horspool_tokens = std::ranges::distance(Split<None>(buffer, HorspoolSearcher{ pattern })); });
+
+    EXPECT_EQ(ranges_tokens, split_tokens);
+    EXPECT_EQ(ranges_tokens, substring_tokens);
+    EXPECT_EQ(ranges_tokens, horspool_tokens);
+  }
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_ParallelSplit)
+{
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  size_t sequential_tokens = 0;
+  size_t parallel_tokens   = 0;
+
+  Measure("SplitIndex{ Split(Text, '\\n') }", buffer.size(), [&] { sequential_tokens = SplitIndex{ Split(buffer, '\n') }.size(); });
+  Measure("ParallelSplit(Text, '\\n', ThreadCount{})", buffer.size(), [&] { parallel_tokens = ParallelSplit(buffer, '\n', ThreadCount{}).size(); });
+
+  EXPECT_EQ(sequential_tokens, parallel_tokens);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_StreamSplit)
+{
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  ptrdiff_t memory_tokens = 0;
+  ptrdiff_t stream_tokens = 0;
+
+  Measure("Split(Text, '\\n')", buffer.size(), [&] { memory_tokens = std::ranges::distance(Split(buffer, '\n')); });
+  Measure("StreamSplit(std::istringstream, '\\n')", buffer.size(), [&]
+  {
+    std::istringstream stream{ buffer };
+    stream_tokens = std::ranges::distance(StreamSplit(stream, '\n'));
+  });
+
+  EXPECT_EQ(memory_tokens, stream_tokens);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_SplitMappedText)
+{
+  const string                buffer = MakeLogBuffer(BufferSize);
+  const std::filesystem::path path   = std::filesystem::temp_directory_path() / "CxxAlgorithmsBenchmarks.log";
+
+  std::ofstream{ path, std::ios::binary }.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+
+  ptrdiff_t copied_tokens = 0;
+  ptrdiff_t mapped_tokens = 0;
+
+  Measure("std::ifstream > std::string > Split", buffer.size(), [&]
+  {
+    std::ifstream file{ path, std::ios::binary };
+    string        text(std::filesystem::file_size(path), '\0');
+    file.read(text.data(), static_cast<std::streamsize>(text.size()));
+    copied_tokens = std::ranges::distance(Split(text, '\n'));
+  });
+
+  Measure("MappedText > Split", buffer.size(), [&]
+  {
+    Cxx::MappedText text{ path };
+    text.Advise(Cxx::MappedText::Advice::Sequential);
+    mapped_tokens = std::ranges::distance(Split(text, '\n'));
+  });
+
+  EXPECT_EQ(copied_tokens, mapped_tokens);
+
+  std::filesystem::remove(path);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_SplitOptions)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  const auto trim = [](const string_view token)
+  {
+    const size_t first = token.find_first_not_of(" \t\n\v\f\r");
+    return first == token.npos ? token.substr(0, 0) : token.substr(first, token.find_last_not_of(" \t\n\v\f\r") - first + 1);
+  };
+
+  const auto not_empty = [](const string_view token) { return not token.empty(); };
+
+  ptrdiff_t layered_tokens = 0;
+  ptrdiff_t fused_tokens   = 0;
+
+  Measure("Split | transform | filter | take", buffer.size(), [&] { layered_tokens = std::ranges::distance(Split<None>(buffer, '=') | std::views::transform(trim) | std::views::filter(not_empty) | std::views::take(BufferSize)); });
+  Measure("Split<RemoveEmptyEntries | TrimEntries>(MaxCount)", buffer.size(), [&] { fused_tokens = std::ranges::distance(Split<RemoveEmptyEntries | TrimEntries>(buffer, '=', BufferSize)); });
+
+  EXPECT_EQ(layered_tokens, fused_tokens);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_SplitInto)
+{
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  size_t vector_tokens = 0;
+  size_t span_tokens   = 0;
+
+  Measure("Split(Line, ' ') | std::ranges::to<std::vector>()", buffer.size(), [&]
+  {
+    vector_tokens = 0;
+
+    for ( const string_view line : Split(buffer, '\n') )
+    {
+      vector_tokens += (Split(line, ' ') | std::ranges::to<std::vector>()).size();
+    }
+  });
+
+  Measure("SplitInto(Line, ' ', std::array)", buffer.size(), [&]
+  {
+    std::array<string_view, 16> fields;
+    span_tokens = 0;
+
+    for ( const string_view line : Split(buffer, '\n') )
+    {
+      span_tokens += SplitInto(line, ' ', fields).Count;
+    }
+  });
+
+  EXPECT_EQ(vector_tokens, span_tokens);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_CsvIndex)
+{
+  constexpr string_view row = "1024,\"Doe, John\",\"He said \"\"hi\"\"\",2023-02-25T10:15:00Z,plain text,,42.5\r\n";
+
+  string buffer;
+  buffer.reserve(BufferSize + row.size());
+
+  while ( buffer.size() < BufferSize )
+  {
+    buffer.append(row);
+  }
+
+  size_t split_fields = 0;
+  size_t csv_fields   = 0;
+
+  Measure("SplitIndex{ SplitAny(Text, \",\\n\") } (sin comillas)", buffer.size(), [&] { split_fields = SplitIndex{ SplitAny<Cxx::Algorithms::StringSplitOptions::None>(buffer, ",\n") }.size(); });
+  Measure("CsvIndex{ Text }", buffer.size(), [&] { csv_fields = CsvIndex{ buffer }.FieldCount(); });
+
+  EXPECT_EQ(csv_fields, buffer.size() / row.size() * 7);
+  EXPECT_GT(split_fields, csv_fields);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_ValidateUtf8)
+{
+  constexpr string_view line = "2023-02-25T10:15:00Z INFO usuario=José acción=descarga tamaño=12 KiB estado=✔ 😀\n";
+
+  string buffer;
+  buffer.reserve(BufferSize + line.size());
+
+  while ( buffer.size() < BufferSize )
+  {
+    buffer.append(line);
+  }
+
+  const string ascii = MakeLogBuffer(BufferSize);
+
+  ptrdiff_t lines               = 0;
+  ptrdiff_t invalid_code_points = 0;
+  bool      valid               = false;
+  bool      valid_ascii         = false;
+
+  Measure("Split(Text, '\\n')", buffer.size(), [&] { lines = std::ranges::distance(Split(buffer, '\n')); });
+  Measure("Views::CodePoints (escalar)", buffer.size(), [&] { invalid_code_points = std::ranges::count(buffer | Cxx::Views::CodePoints, U'\uFFFD'); });
+  Measure("ValidateUtf8(Text)", buffer.size(), [&] { valid = Cxx::Algorithms::IsValidUtf8(buffer); });
+  Measure("ValidateUtf8(Text) (ASCII)", ascii.size(), [&] { valid_ascii = Cxx::Algorithms::IsValidUtf8(ascii); });
+
+  EXPECT_GT(lines, 0);
+  EXPECT_EQ(invalid_code_points, 0);
+  EXPECT_TRUE(valid);
+  EXPECT_TRUE(valid_ascii);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_Join)
+{
+  const string              buffer = MakeLogBuffer(BufferSize);
+  const vector<string_view> words  = SplitAny(buffer, " \n") | std::ranges::to<vector>();
+
+  string stream_result;
+  string join_result;
+
+  Measure("std::ostringstream + MakeOstreamJoiner", buffer.size(), [&]
+  {
+    std::ostringstream output;
+    std::ranges::copy(words, Cxx::DesignPatterns::MakeOstreamJoiner(output, ' '));
+    stream_result = output.str();
+  });
+
+  Measure("Join(std::vector<std::string_view>, ' ')", buffer.size(), [&] { join_result = Join(words, ' '); });
+
+  EXPECT_EQ(stream_result, join_result);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_JoinInto)
+{
+  const string              buffer = MakeLogBuffer(BufferSize);
+  const vector<string_view> lines  = Split(buffer, '\n') | std::ranges::to<vector>();
+
+  size_t join_size      = 0;
+  size_t join_into_size = 0;
+
+  Measure("Join(Fields, ';') por línea", buffer.size(), [&]
+  {
+    std::array<string_view, 16> fields;
+    join_size = 0;
+
+    for ( const string_view line : lines )
+    {
+      const auto result = SplitInto(line, ' ', fields);
+      join_size += Join(std::span{ fields.data(), result.Count }, ';').size();
+    }
+  });
+
+  Measure("JoinInto(Buffer, Fields, ';') por línea", buffer.size(), [&]
+  {
+    std::array<string_view, 16> fields;
+    string                      output;
+    join_into_size = 0;
+
+    for ( const string_view line : lines )
+    {
+      const auto result = SplitInto(line, ' ', fields);
+      output.clear();
+      join_into_size += JoinInto(output, std::span{ fields.data(), result.Count }, ';').size();
+    }
+  });
+
+  EXPECT_EQ(join_size, join_into_size);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_JoinNumbers)
+{
+  std::mt19937_64 engine{ 2023 };
+
+  vector<uint64_t> counters(4 * 1024 * 1024);
+  std::ranges::generate(counters, [&] { return engine() >> (engine() % 64); });
+
+  string stream_result;
+  string join_result;
+
+  Measure("std::ostringstream + MakeOstreamJoiner (enteros)", counters.size() * sizeof(uint64_t), [&]
+  {
+    std::ostringstream output;
+    std::ranges::copy(counters, Cxx::DesignPatterns::MakeOstreamJoiner(output, ','));
+    stream_result = output.str();
+  });
+
+  Measure("Join(std::vector<uint64_t>, ',')", counters.size() * sizeof(uint64_t), [&] { join_result = Join(counters, ','); });
+
+  EXPECT_EQ(stream_result, join_result);
+
+  vector<double> samples(1024 * 1024);
+  std::uniform_real_distribution<double> distribution{ -1000.0, 1000.0 };
+  std::ranges::generate(samples, [&] { return distribution(engine); });
+
+  Measure("std::ostringstream + MakeOstreamJoiner (double)", samples.size() * sizeof(double), [&]
+  {
+    std::ostringstream output;
+    std::ranges::copy(samples, Cxx::DesignPatterns::MakeOstreamJoiner(output, ','));
+    stream_result = output.str();
+  });
+
+  Measure("Join(std::vector<double>, ',')", samples.size() * sizeof(double), [&] { join_result = Join(samples, ','); });
+
+  EXPECT_FALSE(join_result.empty());
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_JoinWith)
+{
+  const string              buffer = MakeLogBuffer(BufferSize);
+  const vector<string_view> fields = SplitAny(buffer, " \n") | std::ranges::to<vector>();
+
+  const TemporaryFile file;
+  ASSERT_NE(file.File(), nullptr);
+
+  size_t join_size      = 0;
+  size_t join_with_size = 0;
+
+  Measure("Join(Fields, ';') + write", buffer.size(), [&]
+  {
+    std::rewind(file.File());
+    const string joined = Join(fields, ';');
+    join_size           = WriteChunks(file.Descriptor(), std::array{ std::span<const char>{ joined } });
+  });
+
+  Measure("WriteChunks(Fields | Views::JoinWith(';'))", buffer.size(), [&]
+  {
+    std::rewind(file.File());
+    join_with_size = WriteChunks(file.Descriptor(), fields | Cxx::Views::JoinWith(';'));
+  });
+
+  EXPECT_EQ(join_size, join_with_size);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_CaseConversion)
+{
+  constexpr std::array<string_view, 8> names{ "Content-Type", "Content-Length", "Accept-Encoding", "X-Forwarded-For", "User-Agent", "Host", "Cache-Control", "Authorization" };
+
+  vector<string> headers;
+  size_t         bytes = 0;
+
+  for ( size_t index = 0; bytes < BufferSize / 4; ++index )
+  {
+    headers.emplace_back(names[index % names.size()]);
+    bytes += headers.back().size();
+  }
+
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  size_t locale_size = 0;
+  size_t copy_size   = 0;
+
+  Measure("std::tolower(c, std::locale()) por caracter", bytes, [&]
+  {
+    locale_size = 0;
+
+    for ( const string& header : headers )
+    {
+      string lower = header;
+
+      for ( char& character : lower )
+      {
+        character = std::tolower(character, std::locale());
+      }
+
+      locale_size += lower.size();
+    }
+  });
+
+  Measure("ToLowerCase(Header)", bytes, [&]
+  {
+    copy_size = 0;
+
+    for ( const string& header : headers )
+    {
+      copy_size += ToLowerCase(header).size();
+    }
+  });
+
+  Measure("ToLowerCaseInPlace(Header)", bytes, [&]
+  {
+    for ( string& header : headers )
+    {
+      ToLowerCaseInPlace(header);
+    }
+  });
+
+  string text = buffer;
+  Measure("ToLowerCaseInPlace(Buffer)", buffer.size(), [&] { ToLowerCaseInPlace(text); });
+
+  EXPECT_EQ(locale_size, copy_size);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_IgnoreCase)
+{
+  using Cxx::Algorithms::IgnoreCase;
+  using Cxx::Algorithms::RangeCompare;
+  using Cxx::Algorithms::Searchers::CaseInsensitiveSearcher;
+
+  constexpr std::array<string_view, 8> names{ "content-type", "Content-Length", "ACCEPT-ENCODING", "X-Forwarded-For", "User-Agent", "host", "Cache-Control", "Authorization" };
+
+  vector<string> headers;
+  size_t         bytes = 0;
+
+  for ( size_t index = 0; bytes < BufferSize / 4; ++index )
+  {
+    headers.emplace_back(names[index % names.size()]);
+    bytes += headers.back().size();
+  }
+
+  const auto& facet = std::use_facet<std::ctype<char>>(std::locale());
+
+  size_t projection_matches = 0;
+  size_t kernel_matches     = 0;
+
+  Measure("RangeCompare(Header, Name, facet.tolower)", bytes, [&]
+  {
+    projection_matches = 0;
+
+    for ( const string& header : headers )
+    {
+      projection_matches += std::is_eq(RangeCompare(header, "Content-Type"sv, [&](const char letter) { return facet.tolower(letter); }));
+    }
+  });
+
+  Measure("RangeCompare(Header, Name, IgnoreCase)", bytes, [&]
+  {
+    kernel_matches = 0;
+
+    for ( const string& header : headers )
+    {
+      kernel_matches += std::is_eq(RangeCompare(header, "Content-Type"sv, IgnoreCase));
+    }
+  });
+
+  EXPECT_EQ(projection_matches, kernel_matches);
+
+  const string buffer = MakeLogBuffer(BufferSize);
+
+  size_t lower_count  = 0;
+  size_t search_count = 0;
+
+  Measure("Split(ToLowerCase(Buffer), \"status=\")", buffer.size(), [&] { lower_count = std::ranges::distance(Split(ToLowerCase(buffer), "status="sv)); });
+  Measure("Split(Buffer, CaseInsensitiveSearcher{ \"STATUS=\" })", buffer.size(), [&] { search_count = std::ranges::distance(Split(buffer, CaseInsensitiveSearcher{ "STATUS="sv })); });
+
+  EXPECT_EQ(lower_count, search_count);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_RangeCompare)
+{
+  using Cxx::Algorithms::RangeCompare;
+
+  const string left  = MakeLogBuffer(BufferSize);
+  string       right = left;
+  right.back()       = '\r';
+
+  const auto project = [](const char character) { return character; };
+
+  std::strong_ordering element_result = std::strong_ordering::equal;
+  std::strong_ordering kernel_result  = std::strong_ordering::equal;
+
+  Measure("RangeCompare(Left, Right, Projection) por elemento", left.size(), [&] { element_result = RangeCompare(left, right, project); });
+  Measure("RangeCompare(Left, Right)", left.size(), [&] { kernel_result = RangeCompare(left, right); });
+
+  EXPECT_EQ(element_result, kernel_result);
+
+  const vector<string_view> lines = Split(left, '\n') | std::ranges::to<vector>();
+
+  size_t element_less = 0;
+  size_t kernel_less  = 0;
+
+  Measure("RangeCompare(Line, Next, Projection) por elemento", left.size(), [&]
+  {
+    element_less = 0;
+
+    for ( size_t index = 1; index < lines.size(); ++index )
+    {
+      element_less += std::is_lt(RangeCompare(lines[index - 1], lines[index], project));
+    }
+  });
+
+  Measure("RangeCompare(Line, Next)", left.size(), [&]
+  {
+    kernel_less = 0;
+
+    for ( size_t index = 1; index < lines.size(); ++index )
+    {
+      kernel_less += std::is_lt(RangeCompare(lines[index - 1], lines[index]));
+    }
+  });
+
+  EXPECT_EQ(element_less, kernel_less);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_RangeCompareParallel)
+{
+  using Cxx::Algorithms::RangeCompare;
+
+  // Equivale a comparar 2 instantáneas de 256 MiB que solo difieren en el último byte.
+  const string left  = MakeLogBuffer(BufferSize * 8);
+  string       right = left;
+  right.back()       = '\r';
+
+  std::strong_ordering sequential_result = std::strong_ordering::equal;
+  std::strong_ordering parallel_result   = std::strong_ordering::equal;
+
+  Measure("RangeCompare(Left, Right)", left.size(), [&] { sequential_result = RangeCompare(left, right); });
+  Measure("RangeCompare(ThreadCount{}, Left, Right)", left.size(), [&] { parallel_result = RangeCompare(ThreadCount{}, left, right); });
+
+  EXPECT_EQ(sequential_result, parallel_result);
+
+  // Con una diferencia al inicio los bloques posteriores se cancelan.
+  right.front() = '\r';
+
+  Measure("RangeCompare(ThreadCount{}, Left, Right) diferencia inicial", left.size(), [&] { parallel_result = RangeCompare(ThreadCount{}, left, right); });
+
+  EXPECT_EQ(parallel_result, RangeCompare(left, right));
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_SortByProjection)
+{
+  using Cxx::Algorithms::SortByProjection;
+
+  // Líneas de log desordenadas; la clave es la línea en minúsculas, una proyección que reserva memoria en cada invocación.
+  const string        buffer = MakeLogBuffer(BufferSize / 8);
+  vector<string_view> lines  = Split(buffer, '\n') | std::ranges::to<vector>();
+  std::ranges::shuffle(lines, std::mt19937{ 2023 });
+
+  size_t     projection_calls = 0;
+  const auto lowered          = [&](const string_view line)
+  {
+    ++projection_calls;
+    return ToLowerCase(line);
+  };
+
+  vector<string_view> projected_sort;
+  vector<string_view> cached_sort;
+
+  Measure("std::ranges::stable_sort(Lines, Less, Projection)", buffer.size(), [&]
+  {
+    projected_sort   = lines;
+    projection_calls = 0;
+    std::ranges::stable_sort(projected_sort, std::less{}, lowered);
+  });
+
+  std::printf("  %zu líneas, %zu invocaciones de la proyección\n", lines.size(), projection_calls);
+
+  Measure("SortByProjection(Lines, Projection)", buffer.size(), [&]
+  {
+    cached_sort      = lines;
+    projection_calls = 0;
+    SortByProjection(cached_sort, lowered);
+  });
+
+  std::printf("  %zu líneas, %zu invocaciones de la proyección\n", lines.size(), projection_calls);
+
+  EXPECT_EQ(projected_sort, cached_sort);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_RangeHash)
+{
+  using Cxx::Algorithms::RangeHash;
+
+  const string              buffer = MakeLogBuffer(BufferSize);
+  const vector<string_view> lines  = Split(buffer, '\n') | std::ranges::to<vector>();
+
+  size_t standard_hash = 0;
+  size_t range_hash    = 0;
+
+  Measure("std::hash<string_view>(Text)", buffer.size(), [&] { standard_hash = std::hash<string_view>{}(buffer); });
+  Measure("RangeHash(Text)", buffer.size(), [&] { range_hash = RangeHash(buffer); });
+
+  Measure("std::hash<string_view>(Line)", buffer.size(), [&]
+  {
+    standard_hash = 0;
+
+    for ( const string_view line : lines )
+    {
+      standard_hash += std::hash<string_view>{}(line);
+    }
+  });
+
+  Measure("RangeHash(Line)", buffer.size(), [&]
+  {
+    range_hash = 0;
+
+    for ( const string_view line : lines )
+    {
+      range_hash += RangeHash(line);
+    }
+  });
+
+  EXPECT_NE(range_hash, 0);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_RangeEditDistance)
+{
+  using Cxx::Algorithms::RangeEditDistance;
+
+  // Pares de líneas consecutivas que se rotan para que no compartan el prefijo, entre 40 y 130 caracteres.
+  const string   buffer = MakeLogBuffer(BufferSize / 32);
+  vector<string> lines;
+
+  for ( const string_view line : Split(buffer, '\n') )
+  {
+    string rotated{ line };
+    std::ranges::rotate(rotated, rotated.begin() + static_cast<ptrdiff_t>(lines.size() % rotated.size()));
+    lines.push_back(lines.size() % 3 == 0 ? rotated + rotated.substr(0, 40) : rotated);
+  }
+
+  // Programación dinámica por filas de O(n * m), la implementación que se reemplaza.
+  const auto naive_distance = [](const string_view left, const string_view right)
+  {
+    vector<size_t> row(right.size() + 1);
+    std::iota(row.begin(), row.end(), size_t{ 0 });
+
+    for ( size_t line = 1; line <= left.size(); ++line )
+    {
+      size_t diagonal = std::exchange(row[0], line);
+
+      for ( size_t column = 1; column <= right.size(); ++column )
+      {
+        const size_t above = row[column];
+        row[column]        = std::min({ above + 1, row[column - 1] + 1, diagonal + (left[line - 1] != right[column - 1]) });
+        diagonal           = above;
+      }
+    }
+
+    return row.back();
+  };
+
+  size_t naive_total   = 0;
+  size_t myers_total   = 0;
+  size_t bounded_total = 0;
+
+  Measure("Naive O(n * m)", buffer.size(), [&]
+  {
+    naive_total = 0;
+
+    for ( size_t index = 1; index < lines.size(); ++index )
+    {
+      naive_total += naive_distance(lines[index - 1], lines[index]);
+    }
+  });
+
+  Measure("RangeEditDistance(Left, Right)", buffer.size(), [&]
+  {
+    myers_total = 0;
+
+    for ( size_t index = 1; index < lines.size(); ++index )
+    {
+      myers_total += RangeEditDistance(lines[index - 1], lines[index]);
+    }
+  });
+
+  Measure("RangeEditDistance(Left, Right, 8)", buffer.size(), [&]
+  {
+    bounded_total = 0;
+
+    for ( size_t index = 1; index < lines.size(); ++index )
+    {
+      bounded_total += RangeEditDistance(lines[index - 1], lines[index], 8) <= 8;
+    }
+  });
+
+  std::printf("  %zu pares, %zu pares con distancia <= 8\n", lines.size() - 1, bounded_total);
+
+  EXPECT_EQ(naive_total, myers_total);
+}
+
+TEST(AlgorithmsBenchmarks, DISABLED_SortStrings)
+{
+  using Cxx::Algorithms::RangeCompare;
+  using Cxx::Algorithms::SortStrings;
+
+  // Tokens de log desordenados: muchas claves comparten prefijos largos (fechas, niveles y rutas).
+  const string        buffer = MakeLogBuffer(BufferSize / 8);
+  vector<string_view> tokens = SplitAny(buffer, " \n") | std::ranges::to<vector>();
+  std::ranges::shuffle(tokens, std::mt19937{ 2023 });
+
+  vector<string_view> compared_sort;
+  vector<string_view> multikey_sort;
+
+  Measure("std::ranges::sort(Tokens, RangeCompare)", buffer.size(), [&]
+  {
+    compared_sort = tokens;
+    std::ranges::sort(compared_sort, [](const string_view left, const string_view right) { return std::is_lt(RangeCompare(left, right)); });
+  });
+
+  Measure("SortStrings(Tokens)", buffer.size(), [&]
+  {
+    multikey_sort = tokens;
+    SortStrings(multikey_sort);
+  });
+
+  std::printf("  %zu tokens\n", tokens.size());
+
+  EXPECT_EQ(compared_sort, multikey_sort);
+}
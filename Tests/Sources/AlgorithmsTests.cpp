@@ -7,11 +7,21 @@
 #include <gmock/gmock.h>
 
 #include "Cxx/Algorithms.hpp"
+#include "TemporaryFile.hpp"
 
 #include <array>
+#include <cstdio>
+#include <deque>
+#include <functional>
+#include <list>
+#include <memory>
+#include <random>
+#include <set>
+#include <unordered_map>
 #include <vector>
 #include <span>
 #include <spanstream>
+#include <sstream>
 
 using ::testing::AtLeast;
 using ::testing::Eq;
@@ -21,8 +31,24 @@ using ::testing::Le;
 using ::testing::Lt;
 using ::testing::Ne;
 
+using Cxx::Algorithms::CsvIndex;
+using Cxx::Algorithms::IsValidUtf8;
 using Cxx::Algorithms::Join;
+using Cxx::Algorithms::JoinInto;
+using Cxx::Algorithms::ParallelSplit;
 using Cxx::Algorithms::Split;
+using Cxx::Algorithms::SplitAny;
+using Cxx::Algorithms::SplitIndex;
+using Cxx::Algorithms::SplitInto;
+using Cxx::Algorithms::StreamSplit;
+using Cxx::Algorithms::ThreadCount;
+using Cxx::Algorithms::ToLowerCase;
+using Cxx::Algorithms::ToLowerCaseInPlace;
+using Cxx::Algorithms::ToUpperCase;
+using Cxx::Algorithms::ToUpperCaseInPlace;
+using Cxx::Algorithms::ValidateUtf8;
+using Cxx::Algorithms::WriteChunks;
+using Cxx::Tests::TemporaryFile;
 
 using std::array;
 using std::span;
@@ -62,6 +88,1347 @@ TEST(AlgorithmsTests, AlgorithmSplit)
   EXPECT_EQ(tokens[21], "6");
 }
 
+TEST(AlgorithmsTests, AlgorithmSplitCharacter)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  constexpr string_view text = ".1......2.....3....4...5..6.";
+
+  auto&& numbers = Split<RemoveEmptyEntries>(text, '.') | std::ranges::to<vector>();
+  auto&& tokens  = Split<None>(text, '.') | std::ranges::to<vector>();
+
+  EXPECT_EQ(tokens, Split<None>(text, ".") | std::ranges::to<vector>());
+  EXPECT_EQ(numbers, Split<RemoveEmptyEntries>(text, ".") | std::ranges::to<vector>());
+  EXPECT_EQ(numbers, (vector<string_view>{ "1", "2", "3", "4", "5", "6" }));
+
+  EXPECT_EQ(std::ranges::distance(Split<None>(""sv, ',')), 0);
+  EXPECT_EQ(std::ranges::distance(Split<RemoveEmptyEntries>(",,,"sv, ',')), 0);
+  EXPECT_EQ(Split<None>("a,b,"sv, ',') | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "" }));
+  EXPECT_EQ(Split<None>(L"a;b"sv, L';') | std::ranges::to<vector>(), (vector<std::wstring_view>{ L"a", L"b" }));
+
+  static_assert(std::ranges::forward_range<decltype(Split(text, '.'))>);
+  static_assert(std::ranges::common_range<decltype(Split(text, '.'))>);
+  static_assert(std::ranges::distance(Split<None>("a.b.c"sv, '.')) == 3);
+}
+
+TEST(AlgorithmsTests, AlgorithmSplitAny)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  constexpr string_view text = "GET /index.html\tHTTP/1.1;;host=example.com|keep-alive ";
+
+  EXPECT_EQ(
+    SplitAny(text, " \t,;|") | std::ranges::to<vector>(), //
+    (vector<string_view>{ "GET", "/index.html", "HTTP/1.1", "host=example.com", "keep-alive" })
+  );
+
+  EXPECT_EQ(
+    SplitAny<None>(text, " \t,;|") | std::ranges::to<vector>(), //
+    (vector<string_view>{ "GET", "/index.html", "HTTP/1.1", "", "host=example.com", "keep-alive", "" })
+  );
+
+  EXPECT_EQ(SplitAny<None>(text, "|") | std::ranges::to<vector>(), Split<None>(text, '|') | std::ranges::to<vector>());
+  EXPECT_EQ(SplitAny(u"a\u00e9b\u4e2dc"sv, u"\u00e9\u4e2d") | std::ranges::to<vector>(), (vector<std::u16string_view>{ u"a", u"b", u"c" }));
+  // Los delimitadores fuera de la tabla se copian al Buscador, por lo que el conjunto puede ser una cadena temporal.
+  const std::wstring wide_text{ L"uno\u2192dos\u2190tres" };
+  vector<std::wstring_view> wide_tokens;
+
+  for ( const std::wstring_view token : SplitAny(wide_text, std::wstring{ L"\u2192\u2190\u2026\u2194\u21D2" }) )
+  {
+    wide_tokens.push_back(token);
+  }
+
+  EXPECT_EQ(wide_tokens, (vector<std::wstring_view>{ L"uno", L"dos", L"tres" }));
+  EXPECT_EQ(std::ranges::distance(SplitAny<None>(""sv, " ")), 0);
+
+  static_assert(std::ranges::distance(SplitAny("a b,c"sv, " ,")) == 3);
+}
+
+TEST(AlgorithmsTests, AlgorithmSplitSearchers)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+  using namespace Cxx::Algorithms::Searchers;
+
+  constexpr string_view boundary = "\r\n--boundary--\r\n";
+  constexpr string_view body     = "--boundary--\r\nfirst\r\n--boundary--\r\n\r\n--boundary--\r\nsecond\r\n--boundary--\r\n";
+
+  const auto reference = [](const string_view text, const string_view pattern)
+  {
+    return text | views::split(pattern) | Cxx::Views::ValuesToStringView | std::ranges::to<vector>();
+  };
+
+  EXPECT_EQ(Split<None>(body, boundary) | std::ranges::to<vector>(), reference(body, boundary));
+  EXPECT_EQ(Split<None>(body, HorspoolSearcher{ boundary }) | std::ranges::to<vector>(), reference(body, boundary));
+  EXPECT_EQ(Split<None>(body, SubstringSearcher{ boundary }) | std::ranges::to<vector>(), reference(body, boundary));
+  EXPECT_EQ(Split<None>(body, std::boyer_moore_horspool_searcher(boundary.begin(), boundary.end())) | std::ranges::to<vector>(), reference(body, boundary));
+  EXPECT_EQ(Split(body, boundary) | std::ranges::to<vector>(), (vector<string_view>{ "--boundary--\r\nfirst", "second" }));
+
+  // Un patrón vacío separa la cadena en caracteres individuales, igual que std::views::split.
+  EXPECT_EQ(Split<None>("abc"sv, ""sv) | std::ranges::to<vector>(), reference("abc", ""));
+
+  const string text = [] {
+    string result;
+
+    for ( size_t index = 0; index < 2048; ++index )
+    {
+      result.push_back("ab"[(index * index + index / 3) % 7 % 2]);
+    }
+
+    return result;
+  }();
+
+  for ( const string_view pattern : { "a"sv, "ab"sv, "aab"sv, "abba"sv, "babababa"sv, "aaaaaaaaaaaaaaab"sv, "abababababababababababab"sv } )
+  {
+    EXPECT_EQ(Split<None>(text, pattern) | std::ranges::to<vector>(), reference(text, pattern)) << pattern;
+    EXPECT_EQ(Split<None>(text, HorspoolSearcher{ pattern }) | std::ranges::to<vector>(), reference(text, pattern)) << pattern;
+  }
+
+  EXPECT_EQ(Split(u"x\u4e2d\u00e9\u4e2d\u00e9\u4e2d\u00e9\u4e2d\u00e9y"sv, HorspoolSearcher{ u"\u4e2d\u00e9\u4e2d\u00e9\u4e2d\u00e9\u4e2d\u00e9"sv }) | std::ranges::to<vector>(), (vector<std::u16string_view>{ u"x", u"y" }));
+
+  static_assert(std::ranges::distance(Split("one--two--three"sv, "--"sv)) == 3);
+  static_assert(std::ranges::distance(Split("one<-->two<-->three"sv, HorspoolSearcher{ "<-->"sv })) == 3);
+}
+
+TEST(AlgorithmsTests, AlgorithmSplitOptions)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  EXPECT_EQ(Split<TrimEntries>(" a , b ,, \tc\n "sv, ',') | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "", "c" }));
+  EXPECT_EQ(Split<RemoveEmptyEntries | TrimEntries>(" a , b , ,, \tc\n "sv, ',') | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "c" }));
+  EXPECT_EQ(Split<RemoveEmptyEntries>(" a , b , ,, \tc\n "sv, ',') | std::ranges::to<vector>(), (vector<string_view>{ " a ", " b ", " ", " \tc\n " }));
+
+  EXPECT_EQ(Split<None>("a,b,c,d"sv, ',', 2) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b,c,d" }));
+  EXPECT_EQ(Split<None>("a,b,"sv, ',', 3) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "" }));
+  EXPECT_EQ(Split<None>("a,b"sv, ',', 8) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b" }));
+  EXPECT_EQ(Split<None>("a,b"sv, ',', 1) | std::ranges::to<vector>(), (vector<string_view>{ "a,b" }));
+  EXPECT_TRUE(std::ranges::empty(Split<None>("a,b"sv, ',', 0)));
+  EXPECT_EQ(Split<RemoveEmptyEntries>(",,a,,b,c"sv, ',', 2) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b,c" }));
+  EXPECT_EQ(Split<RemoveEmptyEntries | TrimEntries>(" , a , ,b , c "sv, ",", 2) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b , c" }));
+  EXPECT_EQ(SplitAny<None>("a b\tc d"sv, " \t", 3) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "c d" }));
+
+  // Las opciones aplicadas en el recorrido equivalen a combinar std::views::transform, std::views::filter y std::views::take.
+  const auto trim = [](const string_view token)
+  {
+    const size_t first = token.find_first_not_of(" \t\n\v\f\r");
+    return first == token.npos ? token.substr(0, 0) : token.substr(first, token.find_last_not_of(" \t\n\v\f\r") - first + 1);
+  };
+
+  for ( const string_view text : { ""sv, ","sv, " "sv, " , "sv, "a"sv, " a ,b,, c ,\t,d "sv, ",, x ,y ,  ,z,,"sv } )
+  {
+    const auto layered = Split<None>(text, ',') | std::views::transform(trim) | std::views::filter([](const string_view token) { return not token.empty(); }) | std::ranges::to<vector>();
+
+    EXPECT_EQ(Split<RemoveEmptyEntries | TrimEntries>(text, ',') | std::ranges::to<vector>(), layered) << text;
+    EXPECT_EQ(SplitIndex{ Split<RemoveEmptyEntries | TrimEntries>(text, ',') } | std::ranges::to<vector>(), layered) << text;
+    EXPECT_EQ(ParallelSplit<RemoveEmptyEntries | TrimEntries>(text, ',') | std::ranges::to<vector>(), layered) << text;
+    EXPECT_EQ(Split<TrimEntries>(text, ',') | std::ranges::to<vector>(), Split<None>(text, ',') | std::views::transform(trim) | std::ranges::to<vector>()) << text;
+  }
+
+  std::istringstream stream{ " a , b , ,, c " };
+  vector<string>     streamed;
+
+  for ( const string_view token : StreamSplit<RemoveEmptyEntries | TrimEntries>(stream, ',') )
+  {
+    streamed.emplace_back(token);
+  }
+
+  EXPECT_EQ(streamed, (vector<string>{ "a", "b", "c" }));
+}
+
+TEST(AlgorithmsTests, AlgorithmSplitConstexpr)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  constexpr auto keys = Split<"Host,Accept,,Content-Type", ",">();
+
+  static_assert(std::same_as<decltype(keys), const array<string_view, 3>>);
+  static_assert(keys[0] == "Host" and keys[1] == "Accept" and keys[2] == "Content-Type");
+
+  constexpr auto entries = Split<"a::b::::c::", "::", None>();
+
+  static_assert(entries.size() == 5);
+  EXPECT_EQ(entries, (array<string_view, 5>{ "a", "b", "", "c", "" }));
+
+  constexpr auto trimmed = Split<L" x ; y ;; z ", L";", RemoveEmptyEntries | TrimEntries>();
+
+  static_assert(std::same_as<decltype(trimmed), const array<std::wstring_view, 3>>);
+  EXPECT_EQ(trimmed, (array<std::wstring_view, 3>{ L"x", L"y", L"z" }));
+
+  static_assert(Split<"", ",">().empty());
+  static_assert(Split<"abc", "">().size() == 3);
+}
+
+TEST(AlgorithmsTests, AlgorithmSplitInto)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+  using Cxx::Algorithms::SplitIntoResult;
+
+  array<string_view, 4> fields{};
+
+  static_assert(noexcept(SplitInto("GET /index.html HTTP/1.1"sv, " "sv, fields)));
+
+  EXPECT_EQ(SplitInto("GET /index.html HTTP/1.1"sv, " "sv, fields), (SplitIntoResult{ 3, false }));
+  EXPECT_THAT(span(fields).first(3), ::testing::ElementsAre("GET", "/index.html", "HTTP/1.1"));
+
+  EXPECT_EQ(SplitInto("a,b,c,d"sv, ',', fields), (SplitIntoResult{ 4, false }));
+  EXPECT_EQ(fields, (array<string_view, 4>{ "a", "b", "c", "d" }));
+
+  EXPECT_EQ(SplitInto<None>("a,,b,c,d,"sv, ',', fields), (SplitIntoResult{ 4, true }));
+  EXPECT_EQ(fields, (array<string_view, 4>{ "a", "", "b", "c" }));
+
+  EXPECT_EQ(SplitInto<RemoveEmptyEntries | TrimEntries>(" a , ,b "sv, ',', fields), (SplitIntoResult{ 2, false }));
+  EXPECT_EQ(SplitInto(""sv, ',', fields), (SplitIntoResult{ 0, false }));
+  EXPECT_EQ(SplitInto("a,b"sv, ',', span<string_view>{}), (SplitIntoResult{ 0, true }));
+
+  vector<string_view> storage(2);
+  EXPECT_EQ(SplitInto("x y"s, ' ', storage), (SplitIntoResult{ 2, false }));
+
+  constexpr auto count = []
+  {
+    array<string_view, 8> tokens{};
+    return SplitInto("1;2;3"sv, ';', tokens).Count;
+  }();
+
+  static_assert(count == 3);
+}
+
+TEST(AlgorithmsTests, AlgorithmSplitIndex)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  string row;
+
+  for ( int32_t column = 0; column < 32; ++column )
+  {
+    row += (column % 5 == 4 ? string{} : "c" + std::to_string(column)) + ',';
+  }
+
+  const SplitIndex columns{ Split<None>(row, ',') };
+  const SplitIndex values{ Split(row, ',') };
+
+  static_assert(std::ranges::random_access_range<decltype(columns)>);
+  static_assert(std::ranges::sized_range<decltype(columns)>);
+  static_assert(std::same_as<std::ranges::range_value_t<decltype(columns)>, string_view>);
+
+  EXPECT_EQ(columns.size(), 33);
+  EXPECT_EQ(columns[17], "c17");
+  EXPECT_EQ(columns[19], "");
+  EXPECT_EQ(columns[32], "");
+  EXPECT_EQ(columns.base().data(), row.data());
+  EXPECT_FALSE(columns.IsWide());
+
+  EXPECT_EQ(values.size(), 26);
+  EXPECT_EQ(values[15], "c18");
+  EXPECT_EQ(columns | std::ranges::to<vector>(), Split<None>(row, ',') | std::ranges::to<vector>());
+  EXPECT_EQ(columns | Cxx::Views::ValuesToStringView | std::ranges::to<vector>(), Split<None>(row, ',') | std::ranges::to<vector>());
+  EXPECT_EQ(values | Cxx::Views::IgnoreEmptyValues | std::ranges::to<vector>(), Split(row, ',') | std::ranges::to<vector>());
+
+  EXPECT_EQ(*(columns.end() - 16), "c17");
+  EXPECT_EQ(columns.begin()[3], "c3");
+  EXPECT_EQ(std::ranges::find(columns, "c30") - columns.begin(), 30);
+  EXPECT_EQ((columns | views::reverse | views::take(2) | std::ranges::to<vector>()), (vector<string_view>{ "", "c31" }));
+
+  EXPECT_TRUE(SplitIndex{ Split(""sv, ',') }.empty());
+  EXPECT_EQ((SplitIndex{ SplitAny("a b\tc"sv, " \t") } | std::ranges::to<vector>()), (vector<string_view>{ "a", "b", "c" }));
+}
+
+TEST(AlgorithmsTests, AlgorithmParallelSplit)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+  using Cxx::Algorithms::Searchers::PatternSearcher;
+
+  string text;
+
+  for ( size_t index = 0; index < 4096; ++index )
+  {
+    text += index % 7 == 0 ? "\n\n" : "line " + std::to_string(index) + (index % 3 == 0 ? "aaa" : "a") + '\n';
+  }
+
+  for ( const string_view pattern : { "\n"sv, "a"sv, "aa"sv, "aaa"sv, "\naa"sv, "line 4"sv, "not found"sv } )
+  {
+    for ( const size_t chunk_count : { 1, 2, 3, 7, 64, 1000 } )
+    {
+      const auto parallel = SplitIndex<char>::Parallel<None>(text, PatternSearcher{ pattern }, chunk_count);
+      const auto filtered = SplitIndex<char>::Parallel<RemoveEmptyEntries>(text, PatternSearcher{ pattern }, chunk_count);
+
+      EXPECT_EQ(parallel | std::ranges::to<vector>(), Split<None>(text, pattern) | std::ranges::to<vector>()) << pattern << " / " << chunk_count;
+      EXPECT_EQ(filtered | std::ranges::to<vector>(), Split<RemoveEmptyEntries>(text, pattern) | std::ranges::to<vector>()) << pattern << " / " << chunk_count;
+    }
+  }
+
+  EXPECT_EQ(ParallelSplit<None>(text, '\n', ThreadCount{ 4 }) | std::ranges::to<vector>(), Split<None>(text, '\n') | std::ranges::to<vector>());
+  EXPECT_EQ(ParallelSplit(text, "\n", ThreadCount{ 4 }) | std::ranges::to<vector>(), Split(text, "\n") | std::ranges::to<vector>());
+  EXPECT_EQ(ParallelSplit<None>("a,b,"sv, ',') | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "" }));
+  EXPECT_EQ(ParallelSplit<None>("abc"sv, ""sv) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "c" }));
+  EXPECT_TRUE(ParallelSplit(""sv, ',').empty());
+}
+
+TEST(AlgorithmsTests, AlgorithmStreamSplit)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  // Los Tokens solo son válidos hasta el siguiente incremento, por eso se copian.
+  const auto collect = [](auto&& tokens)
+  {
+    vector<string> result;
+
+    for ( const string_view token : tokens )
+    {
+      result.emplace_back(token);
+    }
+
+    return result;
+  };
+
+  const auto expected = [](const string_view text, const string_view pattern, const bool remove_empty)
+  {
+    return remove_empty ? Split<RemoveEmptyEntries>(text, pattern) | std::ranges::to<vector<string>>() : Split<None>(text, pattern) | std::ranges::to<vector<string>>();
+  };
+
+  string text;
+
+  for ( size_t index = 0; index < 512; ++index )
+  {
+    text += index % 5 == 0 ? "\r\n\r\n" : "field " + std::to_string(index) + (index % 3 == 0 ? ",aaa" : ",a") + "\r\n";
+  }
+
+  for ( const string_view pattern : { "\r\n"sv, ","sv, "aa"sv, "aaa"sv, "\naa"sv, "field 4"sv, "not found"sv } )
+  {
+    // El buffer debe poder contener el Token más largo junto con el delimitador que lo termina.
+    const size_t minimum = std::ranges::max(Split<None>(text, pattern) | std::views::transform(&string_view::size)) + pattern.size();
+
+    for ( const size_t buffer_size : { minimum, minimum + 1, minimum + 13, 4 * minimum, minimum + (1 << 16) } )
+    {
+      std::istringstream stream{ text };
+      EXPECT_EQ(collect(StreamSplit<None>(stream, pattern, buffer_size)), expected(text, pattern, false)) << pattern << " / " << buffer_size;
+
+      stream = std::istringstream{ text };
+      EXPECT_EQ(collect(StreamSplit<RemoveEmptyEntries>(stream, pattern, buffer_size)), expected(text, pattern, true)) << pattern << " / " << buffer_size;
+    }
+  }
+
+  std::istringstream stream{ "a,b," };
+  EXPECT_EQ(collect(StreamSplit<None>(stream, ',', 2)), (vector<string>{ "a", "b", "" }));
+
+  stream = std::istringstream{ "abc" };
+  EXPECT_EQ(collect(StreamSplit<None>(stream, ""sv, 2)), (vector<string>{ "a", "b", "c" }));
+
+  stream = std::istringstream{ "" };
+  EXPECT_TRUE(collect(StreamSplit<None>(stream, ',')).empty());
+
+  stream = std::istringstream{ "short,much longer token" };
+  EXPECT_THROW(collect(StreamSplit(stream, ',', 8)), Cxx::IOException);
+
+  const TemporaryFile file;
+  ASSERT_NE(file.File(), nullptr);
+  std::fputs(text.c_str(), file.File());
+  std::fflush(file.File());
+  std::rewind(file.File());
+
+  EXPECT_EQ(collect(StreamSplit<None>(file.Descriptor(), "\r\n", 64)), expected(text, "\r\n", false));
+  EXPECT_THROW(collect(StreamSplit(-1, '\n')), Cxx::IOException);
+}
+
+TEST(AlgorithmsTests, AlgorithmCsvIndex)
+{
+  const CsvIndex csv{ "name,quote,empty\r\n\"Doe, John\",\"He said \"\"hi\"\"\",\r\nplain,\"multi\nline\",\"\"\nlast" };
+
+  ASSERT_EQ(csv.RowCount(), 4);
+  EXPECT_EQ(csv.FieldCount(), 10);
+  EXPECT_EQ(csv.Row(0) | std::ranges::to<vector>(), (vector<string_view>{ "name", "quote", "empty" }));
+  EXPECT_EQ(csv[1] | std::ranges::to<vector>(), (vector<string_view>{ "Doe, John", "He said \"\"hi\"\"", "" }));
+  EXPECT_EQ(csv[2] | std::ranges::to<vector>(), (vector<string_view>{ "plain", "multi\nline", "" }));
+  EXPECT_EQ(csv[3] | std::ranges::to<vector>(), (vector<string_view>{ "last" }));
+
+  EXPECT_TRUE(csv.IsQuoted(1, 1));
+  EXPECT_FALSE(csv.IsQuoted(1, 2));
+  EXPECT_TRUE(csv.IsQuoted(2, 2));
+  EXPECT_EQ(csv.Field(1, 1), "He said \"\"hi\"\"");
+  EXPECT_EQ(csv.UnescapedField(1, 1), "He said \"hi\"");
+  EXPECT_EQ(csv.UnescapedField(2, 0), "plain");
+  EXPECT_EQ(CsvIndex::Unescape("a''b''", '\''), "a'b'");
+
+  EXPECT_EQ(CsvIndex{ "" }.RowCount(), 0);
+  EXPECT_EQ(CsvIndex{ "a\n" }.RowCount(), 1);
+  EXPECT_EQ(CsvIndex{ "a,\n\nb" }.FieldCount(), 4);
+  EXPECT_EQ(CsvIndex("a;\"b;c\"", ';').Row(0) | std::ranges::to<vector>(), (vector<string_view>{ "a", "b;c" }));
+
+  // Comparación con un analizador caracter por caracter, con campos que cruzan los bloques de 64 bytes.
+  const auto reference = [](const string_view text)
+  {
+    vector<vector<string_view>> rows;
+    vector<string_view>         row;
+
+    size_t field_first = 0;
+    bool   inside      = false;
+
+    const auto append = [&](size_t first, size_t last, bool end_of_row)
+    {
+      if ( end_of_row and last > first and text[last - 1] == '\r' )
+      {
+        --last;
+      }
+
+      if ( last - first >= 2 and text[first] == '"' and text[last - 1] == '"' )
+      {
+        ++first;
+        --last;
+      }
+
+      row.push_back(text.substr(first, last - first));
+
+      if ( end_of_row )
+      {
+        rows.push_back(std::exchange(row, {}));
+      }
+    };
+
+    for ( size_t index = 0; index < text.size(); ++index )
+    {
+      if ( text[index] == '"' )
+      {
+        inside = not inside;
+      }
+      else if ( not inside and (text[index] == ',' or text[index] == '\n') )
+      {
+        append(field_first, index, text[index] == '\n');
+        field_first = index + 1;
+      }
+    }
+
+    if ( field_first < text.size() or not row.empty() )
+    {
+      append(field_first, text.size(), true);
+    }
+
+    return rows;
+  };
+
+  std::mt19937                     engine{ 4180 };
+  std::uniform_int_distribution<>  length{ 0, 400 };
+  constexpr std::array<char, 8>    alphabet{ 'a', 'b', ',', '"', '"', '\n', '\r', ' ' };
+  std::uniform_int_distribution<>  letter{ 0, alphabet.size() - 1 };
+
+  for ( size_t iteration = 0; iteration < 500; ++iteration )
+  {
+    string text(static_cast<size_t>(length(engine)), ' ');
+    std::ranges::generate(text, [&] { return alphabet[static_cast<size_t>(letter(engine))]; });
+
+    const CsvIndex csv{ text };
+    const auto     rows = reference(text);
+
+    ASSERT_EQ(csv.RowCount(), rows.size()) << text;
+
+    for ( size_t row = 0; row < rows.size(); ++row )
+    {
+      EXPECT_EQ(csv.Row(row) | std::ranges::to<vector>(), rows[row]) << text;
+    }
+  }
+}
+
+TEST(AlgorithmsTests, AlgorithmJoin)
+{
+  const vector<string_view> words{ "uno", "dos", "", "tres" };
+
+  EXPECT_EQ(Join(words, ", "), "uno, dos, , tres");
+  EXPECT_EQ(Join(words, ','), "uno,dos,,tres");
+  EXPECT_EQ(Join(words, ""s), "unodostres");
+  EXPECT_EQ(Join(vector<string>{ "a", "b" }, "--"sv), "a--b");
+  EXPECT_EQ(Join(vector<const char*>{ "x", "yz" }, "/"), "x/yz");
+  EXPECT_EQ(Join(vector<string_view>{}, ", "), "");
+  EXPECT_EQ(Join(vector<string_view>{ "solo" }, ", "), "solo");
+  EXPECT_EQ(Join<wchar_t>(vector<std::wstring_view>{ L"a", L"b" }, L" "), L"a b");
+
+  // Rango de un solo recorrido y elementos que no son cadenas.
+  std::istringstream stream{ "alfa beta gama" };
+  EXPECT_EQ(Join(views::istream<string>(stream), "+"), "alfa+beta+gama");
+  EXPECT_EQ(Join(vector<int32_t>{ 1, 2, 3 }, ", "), "1, 2, 3");
+  EXPECT_EQ(Join(words | views::transform([](string_view word) { return string{ word } + "!"; }), " "), "uno! dos! ! tres!");
+
+  // Los elementos construidos al recorrer el rango pueden cambiar de longitud ó lanzar una excepción en el segundo recorrido.
+  size_t     calls   = 0;
+  const auto growing = [&calls](const string_view word) { return string{ word } + string(calls++ / 4, '!'); };
+  EXPECT_EQ(Join(words | views::transform(growing), " "), "uno! dos! ! tres!");
+
+  calls              = 0;
+  const auto failing = [&calls](const string_view word)
+  {
+    if ( calls++ == 4 )
+    {
+      throw std::runtime_error{ "segundo recorrido" };
+    }
+
+    return string{ word };
+  };
+
+  EXPECT_THROW((void)Join(words | views::transform(failing), " "), std::runtime_error);
+}
+
+TEST(AlgorithmsTests, AlgorithmJoinNumbers)
+{
+  EXPECT_EQ(Join(vector<int32_t>{ 0, -1, 9, 10, 99, 100, -12345, 2147483647, -2147483647 - 1 }, ','), "0,-1,9,10,99,100,-12345,2147483647,-2147483648");
+  EXPECT_EQ(Join(vector<uint64_t>{ 18446744073709551615u, 10000, 9999 }, ", "), "18446744073709551615, 10000, 9999");
+  EXPECT_EQ(Join(vector<int16_t>{}, ","), "");
+  EXPECT_EQ(Join(vector<double>{ 0.1, -2.5, 1e21, 1.0 / 3.0 }, ' '), "0.1 -2.5 1e+21 0.3333333333333333");
+  EXPECT_EQ(Join<wchar_t>(vector<int32_t>{ -7, 42 }, L"; "), L"-7; 42");
+  EXPECT_EQ(Join(views::iota(1, 6), '+'), "1+2+3+4+5");
+
+  // Los elementos que se calculan al recorrer el rango se formatean en un solo recorrido, fuera de resize_and_overwrite.
+  size_t calls = 0;
+  EXPECT_EQ(Join(views::iota(1, 6) | views::transform([&calls](const int32_t value) { return ++calls, value * 10; }), '+'), "10+20+30+40+50");
+  EXPECT_EQ(calls, 5);
+
+  // Los valores de cada tamaño de entero coinciden con los de operator<<.
+  std::mt19937_64 engine{ 1515 };
+
+  for ( size_t iteration = 0; iteration < 200; ++iteration )
+  {
+    vector<int64_t> values(16);
+    std::ranges::generate(values, [&] { return static_cast<int64_t>(engine()) >> (engine() % 64); });
+
+    std::ostringstream expected;
+    std::ranges::copy(values, Cxx::DesignPatterns::MakeOstreamJoiner(expected, ", "));
+
+    ASSERT_EQ(Join(values, ", "), expected.str());
+  }
+
+  string buffer = "metrics=";
+  EXPECT_EQ(JoinInto(buffer, array<uint32_t, 3>{ 1, 20, 300 }, ','), "metrics=1,20,300");
+
+  // bool y los tipos de caracter se siguen escribiendo con operator<<.
+  EXPECT_EQ(Join(vector<bool>{ true, false }, ','), "1,0");
+  EXPECT_EQ(Join(vector<char>{ 'a', 'b' }, ','), "a,b");
+}
+
+TEST(AlgorithmsTests, AlgorithmJoinInto)
+{
+  const vector<string_view> words{ "uno", "dos", "tres" };
+
+  // El contenido previo se conserva y la capacidad se reutiliza entre llamadas.
+  string buffer = "[";
+  EXPECT_EQ(JoinInto(buffer, words, ", "), "[uno, dos, tres");
+  buffer.append("]");
+  EXPECT_EQ(buffer, "[uno, dos, tres]");
+
+  buffer.reserve(256);
+  const auto* const data = buffer.data();
+
+  for ( size_t iteration = 0; iteration < 10; ++iteration )
+  {
+    buffer.clear();
+    JoinInto(buffer, words, ',');
+  }
+
+  EXPECT_EQ(buffer, "uno,dos,tres");
+  EXPECT_EQ(buffer.data(), data);
+
+  EXPECT_EQ(JoinInto(buffer, vector<int32_t>{ 4, 5 }, ' '), "uno,dos,tres4 5");
+
+  // Iteradores de salida: caracter por caracter ó por piezas completas con OutputIteratorAdapter.
+  array<char, 16> characters{};
+  const auto      last = JoinInto(characters.begin(), words, '|');
+  EXPECT_EQ(string_view(characters.begin(), last), "uno|dos|tres");
+
+  string appended;
+  JoinInto(std::back_inserter(appended), vector<char>{ 'a', 'b', 'c' }, ", ");
+  EXPECT_EQ(appended, "a, b, c");
+
+  vector<string_view> pieces;
+  JoinInto(Cxx::DesignPatterns::MakeOutputIterator([&pieces](string_view piece) { pieces.push_back(piece); }), words, " - ");
+  EXPECT_EQ(pieces, (vector<string_view>{ "uno", " - ", "dos", " - ", "tres" }));
+
+  string streamed;
+  JoinInto(Cxx::DesignPatterns::MakeOutputIterator([&streamed](char character) { streamed.push_back(character); }), words, '+');
+  EXPECT_EQ(streamed, "uno+dos+tres");
+}
+
+TEST(AlgorithmsTests, AlgorithmJoinWith)
+{
+  const vector<string_view> words{ "uno", "dos", "", "tres" };
+
+  const auto to_strings = [](auto&& chunks)
+  {
+    vector<string> result;
+
+    for ( const std::span<const char> chunk : chunks )
+    {
+      result.emplace_back(chunk.begin(), chunk.end());
+    }
+
+    return result;
+  };
+
+  EXPECT_EQ(to_strings(words | Cxx::Views::JoinWith(", ")), (vector<string>{ "uno", ", ", "dos", ", ", "", ", ", "tres" }));
+  EXPECT_EQ(to_strings(Cxx::Views::JoinWith(words, '\n')), (vector<string>{ "uno", "\n", "dos", "\n", "", "\n", "tres" }));
+  EXPECT_TRUE(to_strings(vector<string_view>{} | Cxx::Views::JoinWith(", ")).empty());
+  EXPECT_EQ(to_strings(Split("a b c", ' ') | Cxx::Views::JoinWith("+"s)), (vector<string>{ "a", "+", "b", "+", "c" }));
+
+  // El separador se guarda en la vista, por lo que puede ser temporal. Los elementos apuntan al rango original.
+  auto chunks = words | Cxx::Views::JoinWith(string{ " | " });
+  EXPECT_EQ((*chunks.begin()).data(), words[0].data());
+  EXPECT_EQ(std::ranges::distance(chunks), 7);
+
+  // Un elemento temporal (std::string por valor) se destruiría antes de usar su fragmento, por lo que no se acepta.
+  const auto exclaimed = [](const string_view word) { return string{ word } + "!"; };
+  const auto shortened = [](const string_view word) { return word.substr(1); };
+  using JoinWithClosure = decltype(Cxx::Views::JoinWith(", "));
+  static_assert(not std::invocable<JoinWithClosure, decltype(words | views::transform(exclaimed))>);
+  static_assert(std::invocable<JoinWithClosure, decltype(words | views::transform(shortened))>);
+
+  std::istringstream stream{ "alfa beta gama" };
+  EXPECT_EQ(to_strings(views::istream<string>(stream) | Cxx::Views::JoinWith('-')), (vector<string>{ "alfa", "-", "beta", "-", "gama" }));
+
+  // Más fragmentos que WriteChunksBatchSize para escribir varios lotes con writev.
+  vector<string> numbers;
+
+  for ( size_t index = 0; index < 1000; ++index )
+  {
+    numbers.push_back(std::to_string(index));
+  }
+
+  const TemporaryFile file;
+  ASSERT_NE(file.File(), nullptr);
+
+  const string expected = Join(numbers, ", ");
+  EXPECT_EQ(WriteChunks(file.Descriptor(), numbers | Cxx::Views::JoinWith(", ")), expected.size());
+  EXPECT_EQ(file.Content(), expected);
+
+  // Fragmentos grandes (sin copiar) alternados con separadores pequeños (copiados al buffer), en varios lotes.
+  vector<string> lines;
+
+  for ( size_t index = 0; index < 400; ++index )
+  {
+    lines.emplace_back(Cxx::Algorithms::WriteChunksCopyThreshold + index, static_cast<char>('a' + index % 26));
+  }
+
+  const TemporaryFile lines_file;
+  ASSERT_NE(lines_file.File(), nullptr);
+
+  const string expected_lines = Join(lines, "\n");
+  EXPECT_EQ(WriteChunks(lines_file.Descriptor(), lines | Cxx::Views::JoinWith('\n')), expected_lines.size());
+  EXPECT_EQ(lines_file.Content(), expected_lines);
+
+  // En un rango de entrada el elemento se sobrescribe al avanzar, por lo que los fragmentos grandes no pueden quedar pendientes.
+  const string first_token(Cxx::Algorithms::WriteChunksCopyThreshold + 88, 'a');
+  const string second_token(Cxx::Algorithms::WriteChunksCopyThreshold + 88, 'b');
+
+  std::istringstream  tokens{ first_token + ' ' + second_token };
+  const TemporaryFile tokens_file;
+  ASSERT_NE(tokens_file.File(), nullptr);
+
+  EXPECT_EQ(WriteChunks(tokens_file.Descriptor(), views::istream<string>(tokens) | Cxx::Views::JoinWith(' ')), 2 * first_token.size() + 1);
+  EXPECT_EQ(tokens_file.Content(), first_token + ' ' + second_token);
+
+  // Lo mismo con fragmentos temporales en un rango forward.
+  const auto          repeated = [](const size_t index) { return string(Cxx::Algorithms::WriteChunksCopyThreshold, static_cast<char>('a' + index)); };
+  const TemporaryFile repeated_file;
+  ASSERT_NE(repeated_file.File(), nullptr);
+
+  EXPECT_EQ(WriteChunks(repeated_file.Descriptor(), views::iota(size_t{ 0 }, size_t{ 3 }) | views::transform(repeated)), 3 * Cxx::Algorithms::WriteChunksCopyThreshold);
+  EXPECT_EQ(repeated_file.Content(), repeated(0) + repeated(1) + repeated(2));
+
+  EXPECT_THROW(WriteChunks(-1, words | Cxx::Views::JoinWith(", ")), Cxx::IOException);
+}
+
+TEST(AlgorithmsTests, AlgorithmCaseConversion)
+{
+  EXPECT_EQ(ToUpperCase("Content-Type: text/html"sv), "CONTENT-TYPE: TEXT/HTML");
+  EXPECT_EQ(ToLowerCase("Content-Type: TEXT/HTML"s), "content-type: text/html");
+  EXPECT_EQ(ToUpperCase(""), "");
+  EXPECT_EQ(ToUpperCase(L"Denis West"), L"DENIS WEST");
+  EXPECT_EQ(ToLowerCase(u"Denis West"), u"denis west");
+  EXPECT_EQ(ToUpperCase(U"Denis West"), U"DENIS WEST");
+
+  // Solo cambian las letras ASCII: las unidades de código de "ñ" y los caracteres vecinos de las letras se conservan.
+  EXPECT_EQ(ToUpperCase(u8"año@[`{"), u8"AñO@[`{");
+  EXPECT_EQ(ToLowerCase("AÑO@[`{"), "aÑo@[`{");
+
+  // Longitudes que cubren los bloques de 16 bytes y el resto escalar.
+  string text;
+
+  for ( size_t index = 0; index < 100; ++index )
+  {
+    text.push_back(static_cast<char>(index * 7 % 128));
+
+    string expected = text;
+    std::ranges::transform(expected, expected.begin(), [](const char character) { return static_cast<char>(std::toupper(static_cast<unsigned char>(character))); });
+
+    ASSERT_EQ(ToUpperCase(text), expected) << index;
+  }
+
+  // Las variantes InPlace modifican el rango y regresan su referencia.
+  string header = "X-Forwarded-For";
+  EXPECT_EQ(&ToLowerCaseInPlace(header), &header);
+  EXPECT_EQ(header, "x-forwarded-for");
+
+  vector<char> letters{ 'a', 'B', 'c' };
+  ToUpperCaseInPlace(letters);
+  EXPECT_EQ(letters, (vector<char>{ 'A', 'B', 'C' }));
+
+  std::wstring wide = L"Hola Mundo";
+  EXPECT_EQ(ToUpperCaseInPlace(wide), L"HOLA MUNDO");
+}
+
+TEST(AlgorithmsTests, AlgorithmCaseConversionLocale)
+{
+  // Facets que además de las letras ASCII convierten "ñ" en Latin-1 (0xF1 / 0xD1).
+  struct Latin1CharCase : std::ctype<char>
+  {
+      char do_toupper(const char character) const override
+      {
+        return character == '\xF1' ? '\xD1' : std::ctype<char>::do_toupper(character);
+      }
+
+      char do_tolower(const char character) const override
+      {
+        return character == '\xD1' ? '\xF1' : std::ctype<char>::do_tolower(character);
+      }
+
+      const char* do_toupper(char* first, const char* last) const override
+      {
+        std::transform(first, first + (last - first), first, [this](const char character) { return do_toupper(character); });
+        return last;
+      }
+
+      const char* do_tolower(char* first, const char* last) const override
+      {
+        std::transform(first, first + (last - first), first, [this](const char character) { return do_tolower(character); });
+        return last;
+      }
+  };
+
+  struct Latin1WideCase : std::ctype<wchar_t>
+  {
+      wchar_t do_toupper(const wchar_t character) const override
+      {
+        return character == L'\xF1' ? L'\xD1' : std::ctype<wchar_t>::do_toupper(character);
+      }
+
+      wchar_t do_tolower(const wchar_t character) const override
+      {
+        return character == L'\xD1' ? L'\xF1' : std::ctype<wchar_t>::do_tolower(character);
+      }
+
+      const wchar_t* do_toupper(wchar_t* first, const wchar_t* last) const override
+      {
+        std::transform(first, first + (last - first), first, [this](const wchar_t character) { return do_toupper(character); });
+        return last;
+      }
+
+      const wchar_t* do_tolower(wchar_t* first, const wchar_t* last) const override
+      {
+        std::transform(first, first + (last - first), first, [this](const wchar_t character) { return do_tolower(character); });
+        return last;
+      }
+  };
+
+  const std::locale latin1(std::locale(std::locale::classic(), new Latin1CharCase), new Latin1WideCase);
+
+  EXPECT_EQ(ToUpperCase("a\xF1o"sv, latin1), "A\xD1O");
+  EXPECT_EQ(ToLowerCase("A\xD1O"s, latin1), "a\xF1o");
+  EXPECT_EQ(ToUpperCase(L"a\xF1o"sv, latin1), L"A\xD1O");
+  EXPECT_EQ(ToLowerCase(L"A\xD1O", latin1), L"a\xF1o");
+
+  // La configuración "C" solo convierte las letras ASCII, igual que la sobrecarga sin std::locale.
+  EXPECT_EQ(ToUpperCase("a\xF1o"sv, std::locale::classic()), "A\xF1O");
+  EXPECT_EQ(ToUpperCase("Content-Type: text/html"sv, std::locale{}), ToUpperCase("Content-Type: text/html"sv));
+
+  string header = "a\xF1o";
+  EXPECT_EQ(&ToUpperCaseInPlace(header, latin1), &header);
+  EXPECT_EQ(header, "A\xD1O");
+
+  std::wstring wide = L"A\xD1O";
+  EXPECT_EQ(ToLowerCaseInPlace(wide, latin1), L"a\xF1o");
+}
+
+TEST(AlgorithmsTests, AlgorithmRangeCompareBytes)
+{
+  using Cxx::Algorithms::RangeCompare;
+
+  EXPECT_EQ(RangeCompare("abc"sv, "abc"sv), std::strong_ordering::equal);
+  EXPECT_EQ(RangeCompare("abc"sv, "abd"sv), std::strong_ordering::less);
+  EXPECT_EQ(RangeCompare("abc"sv, "ab"sv), std::strong_ordering::greater);
+  EXPECT_EQ(RangeCompare("abcX"sv, "abcY"sv, 3), std::strong_ordering::equal);
+
+  // El orden es el del tipo del elemento y no el de memcmp: char con signo y enteros de varios bytes en little-endian.
+  EXPECT_EQ(RangeCompare(vector<int8_t>{ 1, -1 }, vector<int8_t>{ 1, 1 }), std::strong_ordering::less);
+  EXPECT_EQ(RangeCompare(vector<int32_t>{ 0x0100 }, vector<int32_t>{ 0x0001 }), std::strong_ordering::greater);
+  EXPECT_EQ(RangeCompare(vector<std::byte>{ std::byte{ 0xFF } }, vector<std::byte>{ std::byte{ 0x01 } }), std::strong_ordering::greater);
+
+  // Los kernels deben coincidir con la comparación elemento por elemento, que se obtiene con una proyección distinta de std::identity.
+  std::mt19937 engine{ 2023 };
+
+  const auto check = [&]<typename Type>(std::type_identity<Type>)
+  {
+    const auto project = [](const Type value) { return value; };
+
+    for ( size_t iteration = 0; iteration < 500; ++iteration )
+    {
+      vector<Type> left(engine() % 100);
+      std::ranges::generate(left, [&] { return static_cast<Type>(engine()); });
+
+      vector<Type> right = left;
+
+      if ( not right.empty() and engine() % 4 != 0 )
+      {
+        right[engine() % right.size()] = static_cast<Type>(engine());
+      }
+
+      if ( engine() % 4 == 0 )
+      {
+        right.resize(engine() % (right.size() + 1));
+      }
+
+      const size_t count = engine() % 2 ? static_cast<size_t>(-1) : engine() % 100;
+
+      ASSERT_EQ(RangeCompare(left, right, count), RangeCompare(left, right, count, project)) << iteration;
+      ASSERT_EQ(RangeCompare(right, left, count), RangeCompare(right, left, count, project)) << iteration;
+    }
+  };
+
+  check(std::type_identity<char>{});
+  check(std::type_identity<uint8_t>{});
+  check(std::type_identity<int16_t>{});
+  check(std::type_identity<uint32_t>{});
+  check(std::type_identity<int64_t>{});
+}
+
+TEST(AlgorithmsTests, AlgorithmIgnoreCase)
+{
+  using Cxx::Algorithms::IgnoreCase;
+  using Cxx::Algorithms::RangeCompare;
+  using Cxx::Algorithms::Searchers::CaseInsensitiveSearcher;
+
+  EXPECT_TRUE(std::is_eq(RangeCompare("Content-Type"sv, "content-TYPE"sv, IgnoreCase)));
+  EXPECT_TRUE(std::is_lt(RangeCompare("abc"sv, "ABD"sv, IgnoreCase)));
+  EXPECT_TRUE(std::is_lt(RangeCompare("abc"sv, "ABCD"sv, IgnoreCase)));
+  EXPECT_TRUE(std::is_gt(RangeCompare("abcd"s, "ABC"s, IgnoreCase)));
+  EXPECT_TRUE(std::is_eq(RangeCompare("abcX"sv, "ABCY"sv, 3, IgnoreCase)));
+  EXPECT_TRUE(std::is_eq(RangeCompare(L"Denis West"sv, L"DENIS WEST"sv, IgnoreCase)));
+  EXPECT_TRUE(std::is_eq(RangeCompare(u8"Año"sv, u8"AñO"sv, IgnoreCase)));
+  EXPECT_TRUE(std::is_eq(RangeCompare(std::list<char>{ 'a', 'B' }, "Ab"sv, IgnoreCase)));
+
+  // El resultado de los kernels debe coincidir con la proyección de cada elemento por separado.
+  std::mt19937 engine{ 2023 };
+  const auto   project = [](const char character) { return IgnoreCase(character); };
+
+  for ( size_t iteration = 0; iteration < 2000; ++iteration )
+  {
+    constexpr string_view alphabet = "aAbB-_\xC3\xB1";
+
+    string left(engine() % 40, 'a');
+    std::ranges::generate(left, [&] { return alphabet[engine() % alphabet.size()]; });
+
+    string right = left;
+    std::ranges::transform(right, right.begin(), [&](const char character) { return engine() % 2 ? character : static_cast<char>(std::toupper(static_cast<unsigned char>(character))); });
+
+    if ( not right.empty() and engine() % 2 )
+    {
+      right[engine() % right.size()] = alphabet[engine() % alphabet.size()];
+    }
+
+    if ( engine() % 4 == 0 )
+    {
+      right.resize(engine() % (right.size() + 1));
+    }
+
+    ASSERT_EQ(RangeCompare(left, right, IgnoreCase), RangeCompare(left, right, project)) << left << " " << right;
+
+    const string text    = left + right + left;
+    const auto   pattern = string_view{ right }.substr(0, engine() % 6 + 1);
+
+    if ( not pattern.empty() )
+    {
+      const auto [first, last] = CaseInsensitiveSearcher{ pattern }(text.data(), text.data() + text.size());
+      const auto expected      = ToLowerCase(text).find(ToLowerCase(pattern));
+
+      ASSERT_EQ(first, expected == string::npos ? text.data() + text.size() : text.data() + expected) << text << " " << pattern;
+      ASSERT_EQ(static_cast<size_t>(last - first), expected == string::npos ? 0 : pattern.size());
+    }
+  }
+
+  const string headers = "Host: example.com\r\nCONTENT-TYPE: text/html\r\nAccept: */*\r\ncontent-type: charset=utf-8";
+
+  EXPECT_EQ(Split(headers, CaseInsensitiveSearcher{ "content-type: "sv }) | std::ranges::to<vector>(), (vector<string_view>{ "Host: example.com\r\n", "text/html\r\nAccept: */*\r\n", "charset=utf-8" }));
+  EXPECT_EQ(Split(L"unoXdosxtres"sv, CaseInsensitiveSearcher{ L"x"sv }) | std::ranges::to<vector>(), (vector<std::wstring_view>{ L"uno", L"dos", L"tres" }));
+}
+
+TEST(AlgorithmsTests, AlgorithmRangeMismatch)
+{
+  using Cxx::Algorithms::IgnoreCase;
+  using Cxx::Algorithms::RangeMismatch;
+  using Cxx::Algorithms::RangeMismatchResult;
+
+  using result_t = RangeMismatchResult<std::strong_ordering>;
+
+  EXPECT_EQ(RangeMismatch("abc"sv, "abc"sv), (result_t{ 3, std::strong_ordering::equal }));
+  EXPECT_EQ(RangeMismatch("abc"sv, "abd"sv), (result_t{ 2, std::strong_ordering::less }));
+  EXPECT_EQ(RangeMismatch("abc"sv, "ab"sv), (result_t{ 2, std::strong_ordering::greater }));
+  EXPECT_EQ(RangeMismatch(""sv, "a"sv), (result_t{ 0, std::strong_ordering::less }));
+  EXPECT_EQ(RangeMismatch("abcX"sv, "abcY"sv, 3), (result_t{ 3, std::strong_ordering::equal }));
+  EXPECT_EQ(RangeMismatch("Content-Type"sv, "content-TYPE!"sv, IgnoreCase), (result_t{ 12, std::strong_ordering::less }));
+  EXPECT_EQ(RangeMismatch(std::list<int32_t>{ 1, 2, 3 }, vector<int32_t>{ 1, 2, 4 }), (result_t{ 2, std::strong_ordering::less }));
+  EXPECT_EQ(RangeMismatch(vector<int32_t>{ 1, -2 }, vector<int32_t>{ 1, 2 }), (result_t{ 1, std::strong_ordering::less }));
+  EXPECT_EQ(RangeMismatch(vector<int32_t>{ 1, -2 }, vector<int32_t>{ 1, 2 }, [](const int32_t value) { return std::abs(value); }), (result_t{ 2, std::strong_ordering::equal }));
+
+  // La posición de los kernels (bytes y sin distinguir mayúsculas) debe coincidir con la del recorrido elemento por elemento.
+  std::mt19937 engine{ 2023 };
+  const auto   project = [](const char character) { return character; };
+  const auto   fold    = [](const char character) { return IgnoreCase(character); };
+
+  for ( size_t iteration = 0; iteration < 2000; ++iteration )
+  {
+    string left(engine() % 200, 'a');
+    std::ranges::generate(left, [&] { return "aAbB"[engine() % 4]; });
+
+    string right = left;
+
+    if ( not right.empty() and engine() % 4 != 0 )
+    {
+      right[engine() % right.size()] = "aAbB"[engine() % 4];
+    }
+
+    if ( engine() % 4 == 0 )
+    {
+      right.resize(engine() % (right.size() + 1));
+    }
+
+    const size_t count = engine() % 2 ? static_cast<size_t>(-1) : engine() % 200;
+
+    ASSERT_EQ(RangeMismatch(left, right, count), RangeMismatch(left, right, count, project)) << left << " " << right;
+    ASSERT_EQ(RangeMismatch(left, right, count, IgnoreCase), RangeMismatch(left, right, count, fold)) << left << " " << right;
+    ASSERT_EQ(RangeMismatch(left, right, count).Order, Cxx::Algorithms::RangeCompare(left, right, count));
+  }
+}
+
+TEST(AlgorithmsTests, AlgorithmRangeCompareParallel)
+{
+  using Cxx::Algorithms::RangeCompare;
+
+  constexpr size_t block_size = decltype(RangeCompare)::ParallelBlockSize;
+
+  vector<int32_t> left(block_size * 5 + 123);
+  std::iota(left.begin(), left.end(), 0);
+
+  vector<int32_t> right = left;
+
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, left, right), std::strong_ordering::equal);
+  EXPECT_EQ(RangeCompare(ThreadCount{}, left, right), std::strong_ordering::equal);
+
+  // Con varios bloques distintos el resultado es el del bloque de menor índice.
+  right[block_size * 4 + 7] = -1;
+  right[block_size * 2 + 1] = std::numeric_limits<int32_t>::max();
+  right[block_size * 3]     = -1;
+
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, left, right), std::strong_ordering::less);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, right, left), std::strong_ordering::greater);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, left, right, block_size * 2 + 1), std::strong_ordering::equal);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, left, right, std::compare_weak_order_fallback), std::weak_ordering::less);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 1 }, left, right), RangeCompare(left, right));
+
+  // El tamaño solo decide cuando uno de los rangos es prefijo del otro.
+  right = left;
+  right.pop_back();
+
+  EXPECT_EQ(RangeCompare(ThreadCount{ 3 }, left, right), std::strong_ordering::greater);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 3 }, left, right, right.size()), std::strong_ordering::equal);
+
+  // Rangos de acceso aleatorio no contiguos y proyecciones invocadas desde varios hilos.
+  const std::deque<int32_t> shifted(left.begin(), left.end());
+  const auto                negate = [](const int32_t value) { return -value; };
+
+  right[block_size + 10] = std::numeric_limits<int32_t>::max();
+
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, shifted, left), std::strong_ordering::equal);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, shifted, right), std::strong_ordering::less);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, shifted, right, negate, negate), std::strong_ordering::greater);
+  EXPECT_EQ(RangeCompare(ThreadCount{ 4 }, vector<int32_t>{}, vector<int32_t>{ 1 }), std::strong_ordering::less);
+
+  const auto throwing = [](const int32_t value)
+  {
+    if ( value == 3 * block_size )
+    {
+      throw std::runtime_error("projection");
+    }
+
+    return value;
+  };
+
+  EXPECT_THROW((void)RangeCompare(ThreadCount{ 4 }, left, left, throwing, throwing), std::runtime_error);
+}
+
+TEST(AlgorithmsTests, AlgorithmSortByProjection)
+{
+  using Cxx::Algorithms::SortByProjection;
+
+  size_t calls   = 0;
+  auto   lowered = [&](const string& text)
+  {
+    ++calls;
+    return ToLowerCase(text);
+  };
+
+  vector<string> names{ "delta", "Alpha", "charlie", "BRAVO", "alpha", "Charlie" };
+
+  EXPECT_EQ(&SortByProjection(names, lowered), &names);
+  EXPECT_EQ(names, (vector<string>{ "Alpha", "alpha", "BRAVO", "charlie", "Charlie", "delta" }));
+  EXPECT_EQ(calls, 6);
+
+  // Comparador de 3 vías propio (orden descendente) y elementos que solo se pueden mover.
+  std::deque<std::unique_ptr<int32_t>> pointers;
+
+  for ( const int32_t value : { 3, -7, 5, 0, -1 } )
+  {
+    pointers.push_back(std::make_unique<int32_t>(value));
+  }
+
+  SortByProjection(pointers, [](const std::unique_ptr<int32_t>& pointer) { return std::abs(*pointer); }, [](const int32_t left, const int32_t right) { return right <=> left; });
+
+  EXPECT_EQ(pointers | std::views::transform([](const auto& pointer) { return *pointer; }) | std::ranges::to<vector>(), (vector<int32_t>{ -7, 5, 3, -1, 0 }));
+
+  // Debe coincidir con std::ranges::stable_sort con la misma proyección.
+  std::mt19937 engine{ 2023 };
+
+  for ( size_t iteration = 0; iteration < 200; ++iteration )
+  {
+    vector<std::pair<int32_t, int32_t>> values(engine() % 300);
+
+    for ( size_t index = 0; index < values.size(); ++index )
+    {
+      values[index] = { static_cast<int32_t>(engine() % 20), static_cast<int32_t>(index) };
+    }
+
+    auto expected = values;
+    std::ranges::stable_sort(expected, std::less{}, &std::pair<int32_t, int32_t>::first);
+
+    calls = 0;
+    SortByProjection(values, [&](const std::pair<int32_t, int32_t>& value) { ++calls; return value.first; });
+
+    ASSERT_EQ(values, expected);
+    ASSERT_EQ(calls, values.size());
+  }
+}
+
+TEST(AlgorithmsTests, AlgorithmRangeHash)
+{
+  using Cxx::Algorithms::IgnoreCase;
+  using Cxx::Algorithms::RangeHash;
+  using Cxx::Algorithms::RangeHasher;
+
+  EXPECT_EQ(RangeHash("Cxx::Algorithms"sv), RangeHash("Cxx::Algorithms"s));
+  EXPECT_EQ(RangeHash("Cxx::Algorithms"sv), RangeHash(vector<char>{ 'C', 'x', 'x', ':', ':', 'A', 'l', 'g', 'o', 'r', 'i', 't', 'h', 'm', 's' }));
+  EXPECT_NE(RangeHash("Cxx::Algorithms"sv), RangeHash("Cxx::Algorithmz"sv));
+  EXPECT_EQ(RangeHash("abcX"sv, 3), RangeHash("abcY"sv, 3));
+  EXPECT_EQ(RangeHash("Content-Type"sv, IgnoreCase), RangeHash("content-TYPE"sv, IgnoreCase));
+  EXPECT_EQ(RangeHash(std::list<int32_t>{ 1, 2, 3 }), RangeHash(std::list<int32_t>{ 1, 2, 3 }));
+  EXPECT_NE(RangeHash(vector<string>{ "ab", "" }), RangeHash(vector<string>{ "", "ab" }));
+
+  // Cada prefijo y cada cambio de un solo byte deben producir un hash distinto, en todos los tamaños de bloque de HashBytes.
+  string text(200, '\0');
+  std::ranges::generate(text, [engine = std::mt19937{ 2023 }]() mutable { return static_cast<char>(engine()); });
+
+  std::set<size_t> hashes;
+
+  for ( size_t size = 0; size <= text.size(); ++size )
+  {
+    const string_view prefix{ text.data(), size };
+
+    hashes.insert(RangeHash(prefix));
+
+    for ( size_t index = 0; index < size; ++index )
+    {
+      string changed{ prefix };
+      changed[index] ^= 0x01;
+
+      ASSERT_NE(RangeHash(changed), RangeHash(prefix)) << size << " " << index;
+    }
+  }
+
+  EXPECT_EQ(hashes.size(), text.size() + 1);
+
+  // Los rangos que RangeCompare considera iguales tienen el mismo hash aunque no sean contiguos, en todos los tamaños de bloque.
+  EXPECT_EQ(RangeHash(std::list<char>{ 'a', 'b' }), RangeHash("ab"sv));
+  EXPECT_EQ(RangeHash(std::list<int32_t>{ 1, 2, 3 }), RangeHash(vector<int32_t>{ 1, 2, 3 }));
+
+  for ( const size_t size : { 0, 1, 3, 4, 15, 16, 17, 47, 48, 49, 63, 64, 65, 95, 96, 97, 200 } )
+  {
+    const string_view prefix{ text.data(), size };
+
+    EXPECT_EQ(RangeHash(std::list<char>{ prefix.begin(), prefix.end() }), RangeHash(prefix)) << size;
+    EXPECT_EQ(RangeHash(std::deque<char>{ prefix.begin(), prefix.end() }), RangeHash(prefix)) << size;
+    EXPECT_EQ(RangeHash(std::list<char>{ prefix.begin(), prefix.end() }, size / 2), RangeHash(prefix, size / 2)) << size;
+  }
+
+  // Hasher transparente: el mapa de std::string se consulta con los std::string_view de Split y con cadenas literales.
+  std::unordered_map<string, size_t, RangeHasher, std::equal_to<>> counts;
+
+  for ( const string_view token : Split("GET,POST,GET,PUT,GET"sv, ',') )
+  {
+    if ( const auto iterator = counts.find(token); iterator != counts.end() )
+    {
+      ++iterator->second;
+    }
+    else
+    {
+      counts.emplace(token, 1);
+    }
+  }
+
+  EXPECT_EQ(counts.size(), 3);
+  EXPECT_EQ(counts.find("GET")->second, 3);
+  EXPECT_EQ(counts.find("PUT"sv)->second, 1);
+  EXPECT_EQ(RangeHasher{}("GET"), RangeHasher{}("GET"s));
+}
+
+TEST(AlgorithmsTests, AlgorithmRangeEditDistance)
+{
+  using Cxx::Algorithms::IgnoreCase;
+  using Cxx::Algorithms::RangeEditDistance;
+
+  EXPECT_EQ(RangeEditDistance("kitten"sv, "sitting"sv), 3);
+  EXPECT_EQ(RangeEditDistance("flaw"sv, "lawn"sv), 2);
+  EXPECT_EQ(RangeEditDistance(""sv, "abc"sv), 3);
+  EXPECT_EQ(RangeEditDistance("abc"sv, "abc"s), 0);
+  EXPECT_EQ(RangeEditDistance("kitten"sv, "sitting"sv, 2), 3);
+  EXPECT_EQ(RangeEditDistance("kitten"sv, "sitting"sv, 3), 3);
+  EXPECT_EQ(RangeEditDistance("Content-Type"sv, "content-TYPE"sv, IgnoreCase), 0);
+  EXPECT_EQ(RangeEditDistance(std::list<char>{ 'a', 'b' }, "ba"sv), 2);
+  EXPECT_EQ(RangeEditDistance(L"año"sv, L"anno"sv), 2);
+  EXPECT_EQ(RangeEditDistance(vector<int32_t>{ 1, 2, 3, 4 }, vector<int32_t>{ 1, 3, 4, 5 }), 2);
+
+  // Referencia: programación dinámica completa de O(n * m).
+  const auto expected_distance = [](const string_view left, const string_view right)
+  {
+    vector<vector<size_t>> table(left.size() + 1, vector<size_t>(right.size() + 1));
+
+    for ( size_t line = 0; line <= left.size(); ++line )
+    {
+      for ( size_t column = 0; column <= right.size(); ++column )
+      {
+        if ( line == 0 or column == 0 )
+        {
+          table[line][column] = line + column;
+        }
+        else
+        {
+          table[line][column] = std::min({ table[line - 1][column] + 1, table[line][column - 1] + 1, table[line - 1][column - 1] + (left[line - 1] != right[column - 1]) });
+        }
+      }
+    }
+
+    return table[left.size()][right.size()];
+  };
+
+  // Los tamaños cubren el patrón de una palabra (<= 64), varios bloques y el último bloque parcial.
+  std::mt19937 engine{ 2023 };
+
+  for ( size_t iteration = 0; iteration < 600; ++iteration )
+  {
+    const size_t alphabet = engine() % 2 ? 4 : 26;
+
+    string left(engine() % 300, 'a');
+    std::ranges::generate(left, [&] { return static_cast<char>('a' + engine() % alphabet); });
+
+    string right = left;
+
+    for ( size_t edit = engine() % 40; edit > 0 and not right.empty(); --edit )
+    {
+      const size_t position = engine() % right.size();
+
+      switch ( engine() % 3 )
+      {
+        case 0:
+          right[position] = static_cast<char>('a' + engine() % alphabet);
+          break;
+
+        case 1:
+          right.erase(position, 1);
+          break;
+
+        default:
+          right.insert(position, 1, static_cast<char>('a' + engine() % alphabet));
+          break;
+      }
+    }
+
+    if ( engine() % 8 == 0 )
+    {
+      std::ranges::generate(right, [&] { return static_cast<char>('a' + engine() % alphabet); });
+    }
+
+    const size_t expected = expected_distance(left, right);
+    const size_t maximum  = engine() % 50;
+
+    ASSERT_EQ(RangeEditDistance(left, right), expected) << left << " " << right;
+    ASSERT_EQ(RangeEditDistance(right, left), expected) << left << " " << right;
+    ASSERT_EQ(RangeEditDistance(left, right, maximum), std::min(expected, maximum + 1)) << left << " " << right << " " << maximum;
+    ASSERT_EQ(RangeEditDistance(std::wstring(left.begin(), left.end()), std::wstring(right.begin(), right.end()), maximum), std::min(expected, maximum + 1));
+  }
+}
+
+TEST(AlgorithmsTests, AlgorithmSortStrings)
+{
+  using Cxx::Algorithms::RangeCompare;
+  using Cxx::Algorithms::SortStrings;
+
+  const auto less = [](const auto& left, const auto& right) { return std::is_lt(RangeCompare(left, right)); };
+
+  vector<string_view> words{ "pear", "apple", "", "app", "application", "apple", "b", "\x80", "\x01", "app\0"sv, "applications" };
+  vector<string_view> sorted = words;
+  std::ranges::sort(sorted, less);
+
+  EXPECT_EQ(&SortStrings(words), &words);
+  EXPECT_EQ(words, sorted);
+
+  vector<string_view> empty;
+  EXPECT_TRUE(SortStrings(empty).empty());
+
+  // Proyección a una clave por valor y a un miembro.
+  struct Person
+  {
+      string Name;
+      size_t Age;
+  };
+
+  vector<Person> people{ { "carlos", 30 }, { "Ana", 25 }, { "beatriz", 41 }, { "ANA", 19 } };
+
+  SortStrings(people, [](const Person& person) { return ToLowerCase(person.Name); });
+  EXPECT_EQ(people | std::views::transform([](const Person& person) { return ToLowerCase(person.Name); }) | std::ranges::to<vector>(), (vector<string>{ "ana", "ana", "beatriz", "carlos" }));
+
+  SortStrings(people, &Person::Name);
+  EXPECT_EQ(people | std::views::transform(&Person::Name) | std::ranges::to<vector>(), (vector<string>{ "ANA", "Ana", "beatriz", "carlos" }));
+
+  // Debe coincidir con std::ranges::sort y RangeCompare: prefijos comunes largos, duplicados, bytes con el bit alto y caracteres anchos.
+  std::mt19937 engine{ 2023 };
+
+  const auto check = [&]<typename CharType>(std::type_identity<CharType>)
+  {
+    using String = std::basic_string<CharType>;
+
+    for ( size_t iteration = 0; iteration < 20; ++iteration )
+    {
+      const String common(engine() % 20, static_cast<CharType>('x'));
+
+      vector<String> values(engine() % 2000);
+
+      for ( String& value : values )
+      {
+        value = common.substr(0, engine() % (common.size() + 1));
+        value.resize(value.size() + engine() % 12);
+
+        for ( size_t index = value.size() - value.size() % 12; index < value.size(); ++index )
+        {
+          value[index] = static_cast<CharType>(engine() % 3 == 0 ? engine() : 'a' + engine() % 3);
+        }
+      }
+
+      auto expected = values;
+      std::ranges::sort(expected, [](const String& left, const String& right) { return std::is_lt(RangeCompare(left, right)); });
+
+      SortStrings(values);
+
+      ASSERT_EQ(values, expected) << iteration;
+    }
+  };
+
+  check(std::type_identity<char>{});
+  check(std::type_identity<char8_t>{});
+  check(std::type_identity<wchar_t>{});
+  check(std::type_identity<char16_t>{});
+}
+
+TEST(AlgorithmsTests, AlgorithmUtf8)
+{
+  using enum Cxx::Algorithms::StringSplitOptions;
+
+  EXPECT_TRUE(IsValidUtf8(u8"año ∑ 😀"_zs));
+  EXPECT_TRUE(IsValidUtf8(std::u8string_view{}));
+  EXPECT_TRUE(IsValidUtf8("plain ascii"sv));
+
+  // Secuencia incompleta, sobrelarga, sustituto, mayor que U+10FFFF, continuación sin inicio y byte prohibido.
+  for ( const string_view invalid : { "ab\xE2\x82"sv, "ab\xC0\xAF"sv, "ab\xED\xA0\x80"sv, "ab\xF4\x90\x80\x80"sv, "ab\x80"sv, "ab\xFF"sv } )
+  {
+    const auto result = ValidateUtf8(invalid);
+    EXPECT_FALSE(result.Valid) << invalid;
+    EXPECT_EQ(result.Position, 2) << invalid;
+  }
+
+  EXPECT_EQ(u8"a€😀"_zs | Cxx::Views::CodePoints | std::ranges::to<std::u32string>(), U"a€😀");
+  EXPECT_EQ("a\xE2\x82!\xC0\xAF"sv | Cxx::Views::CodePoints | std::ranges::to<std::u32string>(), U"a\uFFFD!\uFFFD\uFFFD");
+
+  EXPECT_EQ(Split(u8"uno→dos→→tres"sv, U'→') | std::ranges::to<vector>(), (vector<std::u8string_view>{ u8"uno", u8"dos", u8"tres" }));
+  EXPECT_EQ(Split<None>("a😀b😀"sv, U'😀') | std::ranges::to<vector>(), (vector<string_view>{ "a", "b", "" }));
+  EXPECT_EQ(Split(u8"a,b"sv, U',') | std::ranges::to<vector>(), (vector<std::u8string_view>{ u8"a", u8"b" }));
+  EXPECT_EQ(Split(u8"a,b"sv, u8',') | std::ranges::to<vector>(), (vector<std::u8string_view>{ u8"a", u8"b" }));
+
+  // Comparación con un validador escalar directo, con textos que cruzan los bloques de 64 bytes.
+  const auto reference = [](const string_view text) -> size_t
+  {
+    for ( size_t index = 0; index < text.size(); )
+    {
+      const auto   lead   = static_cast<uint8_t>(text[index]);
+      const size_t length = lead < 0x80 ? 1 : (lead >> 5) == 0x6 ? 2 : (lead >> 4) == 0xE ? 3 : (lead >> 3) == 0x1E ? 4 : 0;
+
+      if ( length == 0 or index + length > text.size() )
+      {
+        return index;
+      }
+
+      char32_t code_point = length == 1 ? lead : lead & (0x7F >> length);
+
+      for ( size_t offset = 1; offset < length; ++offset )
+      {
+        const auto unit = static_cast<uint8_t>(text[index + offset]);
+
+        if ( (unit & 0xC0) != 0x80 )
+        {
+          return index;
+        }
+
+        code_point = (code_point << 6) | (unit & 0x3F);
+      }
+
+      constexpr std::array<char32_t, 5> minimum{ 0, 0, 0x80, 0x800, 0x10000 };
+
+      if ( code_point < minimum[length] or code_point > 0x10FFFF or (code_point >= 0xD800 and code_point <= 0xDFFF) )
+      {
+        return index;
+      }
+
+      index += length;
+    }
+
+    return text.size();
+  };
+
+  std::mt19937                      engine{ 3629 };
+  std::uniform_int_distribution<>   length{ 0, 300 };
+  constexpr std::array<string_view, 7> pieces{ "a", "bc", "ñ", "€", "😀", "\xED\x9F\xBF", "\xF4\x8F\xBF\xBF" };
+  std::uniform_int_distribution<>   piece{ 0, pieces.size() - 1 };
+  std::uniform_int_distribution<>   byte{ 0, 255 };
+
+  for ( size_t iteration = 0; iteration < 2000; ++iteration )
+  {
+    string text;
+
+    while ( text.size() < static_cast<size_t>(length(engine)) )
+    {
+      text.append(pieces[static_cast<size_t>(piece(engine))]);
+    }
+
+    // La mitad de los textos tiene un byte aleatorio en una posición aleatoria.
+    if ( not text.empty() and iteration % 2 == 1 )
+    {
+      text[static_cast<size_t>(byte(engine)) * text.size() / 256] = static_cast<char>(byte(engine));
+    }
+
+    const size_t expected = reference(text);
+    const auto   result   = ValidateUtf8(text);
+
+    ASSERT_EQ(result.Position, expected) << iteration;
+    ASSERT_EQ(result.Valid, expected == text.size()) << iteration;
+  }
+}
+
 TEST(AlgorithmsTests, CompareStrings)
 {
   using namespace Cxx::Algorithms;
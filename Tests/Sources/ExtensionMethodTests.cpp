@@ -70,6 +70,13 @@ TEST(ExtensionMethodTest, PropertyExtension)
   EXPECT_EQ(Value->*LowerCase, "denis west");
   EXPECT_EQ(Value->*UpperCase, "DENIS WEST");
   EXPECT_EQ(Value->*UpperCase->*Length, 10);
+
+  // Las cadenas constantes y temporales se convierten en una copia.
+  const std::string Constant = "Denis West";
+  EXPECT_EQ(Constant->*UpperCase, "DENIS WEST");
+  EXPECT_EQ(Constant, "Denis West");
+  EXPECT_EQ("Denis West"s->*LowerCase, "denis west");
+  EXPECT_EQ("Denis West"sv->*UpperCase, "DENIS WEST");
 }
 
 TEST(ExtensionMethodTest, BooleanStringPropertyExtension)
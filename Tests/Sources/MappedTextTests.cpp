@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+
+#include "Cxx/MappedText.hpp"
+#include "Cxx/Algorithms.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <ranges>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using Cxx::MappedText;
+
+using namespace std::string_view_literals;
+
+namespace
+{
+  std::filesystem::path WriteTemporaryFile(const std::string_view name, const std::string_view content)
+  {
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+
+    std::ofstream file{ path, std::ios::binary | std::ios::trunc };
+    file.write(content.data(), static_cast<std::streamsize>(content.size()));
+
+    return path;
+  }
+} // namespace
+
+TEST(MappedTextTests, MapFile)
+{
+  const auto path = WriteTemporaryFile("CxxMappedTextTests.txt", "uno\ndos\n\ntres");
+
+  MappedText text{ path };
+  text.Advise(MappedText::Advice::Sequential);
+
+  EXPECT_EQ(text.size(), 13);
+  EXPECT_EQ(text.AsStringView(), "uno\ndos\n\ntres"sv);
+  EXPECT_EQ(text.c_str()[text.size()], '\0');
+  EXPECT_EQ(text.AsZString().size(), text.size());
+  EXPECT_EQ(Cxx::Algorithms::Split(text, '\n') | std::ranges::to<std::vector>(), (std::vector<std::string_view>{ "uno", "dos", "tres" }));
+
+  MappedText moved = std::move(text);
+  EXPECT_TRUE(text.empty());
+  EXPECT_EQ(std::string_view{ moved }, "uno\ndos\n\ntres"sv);
+
+  std::filesystem::remove(path);
+}
+
+TEST(MappedTextTests, NullTerminatedOnPageBoundary)
+{
+  // El tamaño es múltiplo del tamaño de página, por lo que el '\0' queda fuera de las páginas del archivo.
+  const std::string content(64 * 1024, 'x');
+  const auto        path = WriteTemporaryFile("CxxMappedTextPageTests.txt", content);
+
+  const MappedText text{ path };
+
+  EXPECT_EQ(text.AsStringView(), content);
+  EXPECT_EQ(text.c_str()[text.size()], '\0');
+
+  std::filesystem::remove(path);
+}
+
+TEST(MappedTextTests, EmptyFile)
+{
+  const auto path = WriteTemporaryFile("CxxMappedTextEmptyTests.txt", "");
+
+  const MappedText text{ path };
+
+  EXPECT_TRUE(text.empty());
+  EXPECT_EQ(text.c_str()[0], '\0');
+  EXPECT_TRUE(std::ranges::empty(Cxx::Algorithms::Split(text, '\n')));
+
+  std::filesystem::remove(path);
+}
+
+TEST(MappedTextTests, MissingFile)
+{
+  try
+  {
+    const MappedText text{ std::filesystem::temp_directory_path() / "CxxMappedTextMissing.txt" };
+    FAIL() << "Cxx::IOException expected";
+  }
+  catch ( const Cxx::IOException& exception )
+  {
+    EXPECT_EQ(exception.ErrorCode(), std::errc::no_such_file_or_directory);
+  }
+}
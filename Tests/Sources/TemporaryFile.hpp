@@ -0,0 +1,74 @@
+#ifndef E3B1C6D2_7A4F_4C8E_9B2D_5F1A0C7E8D43
+#define E3B1C6D2_7A4F_4C8E_9B2D_5F1A0C7E8D43
+
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace Cxx::Tests
+{
+  /**
+   * @brief Archivo temporal creado con std::tmpfile que se cierra al salir del alcance.
+   */
+  class TemporaryFile
+  {
+    public:
+      TemporaryFile()
+        : m_File{ std::tmpfile() }
+      {
+      }
+
+      TemporaryFile(const TemporaryFile&)            = delete;
+      TemporaryFile& operator=(const TemporaryFile&) = delete;
+
+      ~TemporaryFile()
+      {
+        if ( m_File != nullptr )
+        {
+          std::fclose(m_File);
+        }
+      }
+
+      [[nodiscard]] std::FILE* File() const noexcept
+      {
+        return m_File;
+      }
+
+      /**
+       * @brief Descriptor de archivo para las funciones que escriben ó leen con write/read.
+       */
+      [[nodiscard]] int32_t Descriptor() const noexcept
+      {
+#if defined(_WIN32)
+        return _fileno(m_File);
+#else
+        return fileno(m_File);
+#endif
+      }
+
+      /**
+       * @brief Regresa todo el contenido del archivo, incluido lo escrito directamente en el descriptor.
+       */
+      [[nodiscard]] std::string Content() const
+      {
+        std::rewind(m_File);
+
+        std::string            content;
+        std::array<char, 4096> buffer;
+        size_t                 count = 0;
+
+        while ( (count = std::fread(buffer.data(), 1, buffer.size(), m_File)) > 0 )
+        {
+          content.append(buffer.data(), count);
+        }
+
+        return content;
+      }
+
+    private:
+      std::FILE* m_File;
+  };
+} // namespace Cxx::Tests
+
+#endif /* E3B1C6D2_7A4F_4C8E_9B2D_5F1A0C7E8D43 */